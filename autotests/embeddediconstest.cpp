@@ -0,0 +1,98 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "embeddedicons_p.h"
+
+#include <QDir>
+#include <QFile>
+#include <QIcon>
+#include <QImage>
+#include <QTemporaryDir>
+#include <QTest>
+
+using namespace Kirigami;
+
+class EmbeddedIconsTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void init();
+    void indexedIcon();
+    void missFallsBackToTheme();
+    void otherTheme();
+
+private:
+    void writeImage(const QString &path, int size);
+
+    QTemporaryDir m_dir;
+};
+
+void EmbeddedIconsTest::writeImage(const QString &path, int size)
+{
+    QImage image(size, size, QImage::Format_ARGB32);
+    image.fill(Qt::red);
+    QVERIFY(image.save(path));
+}
+
+void EmbeddedIconsTest::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+    const QDir dir(m_dir.path());
+
+    // The embedded icons, with their index
+    QVERIFY(dir.mkpath(QStringLiteral("embedded")));
+    writeImage(dir.filePath(QStringLiteral("embedded/indexed.png")), 22);
+    QFile index(dir.filePath(QStringLiteral("embedded/breeze-internal.index")));
+    QVERIFY(index.open(QIODevice::WriteOnly));
+    index.write("# test index\nindexed-icon\t22\tindexed.png\n");
+    index.close();
+
+    // A regular breeze-internal theme, with an icon the index doesn't know
+    QVERIFY(dir.mkpath(QStringLiteral("themes/breeze-internal/22")));
+    QFile theme(dir.filePath(QStringLiteral("themes/breeze-internal/index.theme")));
+    QVERIFY(theme.open(QIODevice::WriteOnly));
+    theme.write("[Icon Theme]\nName=breeze-internal\nDirectories=22\n\n[22]\nSize=22\nType=Fixed\n");
+    theme.close();
+    writeImage(dir.filePath(QStringLiteral("themes/breeze-internal/22/application-only.png")), 22);
+
+    QIcon::setThemeSearchPaths({dir.filePath(QStringLiteral("themes"))});
+    QVERIFY(EmbeddedIcons::load(dir.filePath(QStringLiteral("embedded/breeze-internal.index"))));
+    QVERIFY(EmbeddedIcons::isLoaded());
+}
+
+void EmbeddedIconsTest::init()
+{
+    QIcon::setThemeName(QStringLiteral("breeze-internal"));
+}
+
+void EmbeddedIconsTest::indexedIcon()
+{
+    const QIcon icon = EmbeddedIcons::fromTheme(QStringLiteral("indexed-icon"));
+    QVERIFY(!icon.isNull());
+    QCOMPARE(icon.availableSizes(), QList<QSize>{QSize(22, 22)});
+
+    // Served from the cache the second time
+    QCOMPARE(EmbeddedIcons::fromTheme(QStringLiteral("indexed-icon")).cacheKey(), icon.cacheKey());
+}
+
+void EmbeddedIconsTest::missFallsBackToTheme()
+{
+    QVERIFY(!EmbeddedIcons::fromTheme(QStringLiteral("application-only")).isNull());
+    QVERIFY(EmbeddedIcons::fromTheme(QStringLiteral("not-an-icon-anywhere")).isNull());
+}
+
+void EmbeddedIconsTest::otherTheme()
+{
+    QIcon::setThemeName(QStringLiteral("some-other-theme"));
+    // The index is only used for breeze-internal
+    QVERIFY(EmbeddedIcons::fromTheme(QStringLiteral("indexed-icon")).isNull());
+}
+
+QTEST_MAIN(EmbeddedIconsTest)
+
+#include "embeddediconstest.moc"
@@ -0,0 +1,64 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "palettegenerator.h"
+
+#include <QLoggingCategory>
+#include <QTest>
+
+#include <algorithm>
+
+// Provided by the plugin otherwise
+Q_LOGGING_CATEGORY(KirigamiLog, "kf.kirigami", QtWarningMsg)
+
+class PaletteGeneratorTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void tiledMatchesUntiled();
+};
+
+void PaletteGeneratorTest::tiledMatchesUntiled()
+{
+    // Large enough to be tiled, with areas of three colors spanning many tiles
+    // and some variation inside each of them
+    QImage image(1024, 768, QImage::Format_ARGB32);
+    for (int y = 0; y < image.height(); ++y) {
+        for (int x = 0; x < image.width(); ++x) {
+            const int variation = (x + y) % 16;
+            if (y < image.height() / 2) {
+                image.setPixel(x, y, qRgb(200 + variation, 40, 40));
+            } else if (x < image.width() / 3) {
+                image.setPixel(x, y, qRgb(40, 180 + variation, 60));
+            } else {
+                image.setPixel(x, y, qRgb(30, 50, 190 + variation));
+            }
+        }
+    }
+    QVERIFY(image.width() * image.height() >= PaletteGenerator::s_tiledMinimumPixels);
+
+    const ImageData untiled = PaletteGenerator::generatePalette(image);
+    const ImageData tiled = PaletteGenerator::generatePaletteTiled(image);
+
+    QCOMPARE(tiled.m_average, untiled.m_average);
+    QVERIFY(!tiled.m_palette.isEmpty());
+
+    // Palette colors may differ by less than the distance at which clusters are merged
+    QVERIFY(PaletteGenerator::squareDistance(tiled.m_dominant.rgb(), untiled.m_dominant.rgb()) < PaletteGenerator::s_minimumSquareDistance);
+    for (const auto &entry : untiled.m_palette) {
+        const QColor color = entry.toMap().value(QStringLiteral("color")).value<QColor>();
+        const bool found = std::any_of(tiled.m_palette.cbegin(), tiled.m_palette.cend(), [&color](const QVariant &tiledEntry) {
+            const QColor tiledColor = tiledEntry.toMap().value(QStringLiteral("color")).value<QColor>();
+            return PaletteGenerator::squareDistance(tiledColor.rgb(), color.rgb()) < PaletteGenerator::s_minimumSquareDistance;
+        });
+        QVERIFY2(found, qPrintable(color.name()));
+    }
+}
+
+QTEST_GUILESS_MAIN(PaletteGeneratorTest)
+
+#include "palettegeneratortest.moc"
@@ -0,0 +1,213 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "paletteindex.h"
+
+#include <QLoggingCategory>
+#include <QRegularExpression>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QtEndian>
+
+// Provided by the plugin otherwise
+Q_LOGGING_CATEGORY(KirigamiLog, "kf.kirigami", QtWarningMsg)
+
+// Layout of the file, see paletteindex.cpp
+static const int s_headerSize = 16;
+static const int s_firstColorOffset = s_headerSize + 24;
+static const int s_colorCountOffset = s_headerSize + 28;
+
+static PaletteIndex::Entry makeEntry(const QString &path, quint64 contentHash, const QVector<QColor> &colors)
+{
+    PaletteIndex::Entry entry;
+    entry.path = path;
+    entry.contentHash = contentHash;
+    entry.imageData.m_average = QColor(10, 20, 30);
+    entry.imageData.m_dominant = colors.first();
+    entry.imageData.m_dominantContrast = QColor(Qt::white);
+    entry.imageData.m_highlight = colors.last();
+    entry.imageData.m_closestToBlack = QColor(Qt::black);
+    entry.imageData.m_closestToWhite = QColor(Qt::white);
+    for (const QColor &color : colors) {
+        QVariantMap paletteEntry;
+        paletteEntry[QStringLiteral("color")] = color;
+        paletteEntry[QStringLiteral("ratio")] = 1.0 / colors.size();
+        paletteEntry[QStringLiteral("contrastColor")] = QColor(Qt::white);
+        entry.imageData.m_palette << paletteEntry;
+    }
+    return entry;
+}
+
+class PaletteIndexTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void roundTrip();
+    void contentHashMismatch();
+    void truncatedHeader_data();
+    void truncatedHeader();
+    void colorsPastEnd_data();
+    void colorsPastEnd();
+
+private:
+    QString writeIndex(const QString &name);
+    QString patchIndex(const QString &fileName, const QString &name, int offset, quint32 value);
+
+    QTemporaryDir m_dir;
+};
+
+void PaletteIndexTest::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+}
+
+QString PaletteIndexTest::writeIndex(const QString &name)
+{
+    const QString fileName = m_dir.filePath(name);
+    const QVector<PaletteIndex::Entry> entries = {
+        makeEntry(QStringLiteral("/images/red.png"), 1, {QColor(200, 0, 0), QColor(100, 0, 0)}),
+        makeEntry(QStringLiteral("/images/blue.jpg"), 2, {QColor(0, 0, 200)}),
+    };
+    if (!PaletteIndex::write(fileName, entries)) {
+        return QString();
+    }
+    return fileName;
+}
+
+// Copies an index to a new file with the 32 bit value at offset replaced
+QString PaletteIndexTest::patchIndex(const QString &fileName, const QString &name, int offset, quint32 value)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+    QByteArray data = file.readAll();
+    qToLittleEndian(value, data.data() + offset);
+
+    QFile patched(m_dir.filePath(name));
+    if (!patched.open(QIODevice::WriteOnly) || patched.write(data) != data.size()) {
+        return QString();
+    }
+    return patched.fileName();
+}
+
+void PaletteIndexTest::roundTrip()
+{
+    const QString fileName = writeIndex(QStringLiteral("roundtrip.kpal"));
+    QVERIFY(!fileName.isEmpty());
+
+    const auto index = PaletteIndex::open(fileName);
+    QVERIFY(index);
+    QCOMPARE(PaletteIndex::open(fileName), index);
+
+    QVERIFY(index->contains(QStringLiteral("/images/red.png")));
+    QVERIFY(index->contains(QStringLiteral("/images/blue.jpg")));
+    QVERIFY(!index->contains(QStringLiteral("/images/green.png")));
+
+    ImageData red;
+    QVERIFY(index->lookup(QStringLiteral("/images/red.png"), 1, red));
+    QCOMPARE(red.m_average, QColor(10, 20, 30));
+    QCOMPARE(red.m_dominant, QColor(200, 0, 0));
+    QCOMPARE(red.m_highlight, QColor(100, 0, 0));
+    QCOMPARE(red.m_closestToBlack, QColor(Qt::black));
+    QCOMPARE(red.m_clusters.size(), 2);
+    QCOMPARE(red.m_palette.size(), 2);
+    const auto first = red.m_palette.first().toMap();
+    QCOMPARE(first.value(QStringLiteral("color")).value<QColor>(), QColor(200, 0, 0));
+    QCOMPARE(first.value(QStringLiteral("contrastColor")).value<QColor>(), QColor(Qt::white));
+    QCOMPARE(first.value(QStringLiteral("ratio")).toReal(), 0.5);
+
+    ImageData blue;
+    QVERIFY(index->lookup(QStringLiteral("/images/blue.jpg"), 2, blue));
+    QCOMPARE(blue.m_dominant, QColor(0, 0, 200));
+    QCOMPARE(blue.m_palette.size(), 1);
+}
+
+void PaletteIndexTest::contentHashMismatch()
+{
+    const QString fileName = writeIndex(QStringLiteral("mismatch.kpal"));
+    const auto index = PaletteIndex::open(fileName);
+    QVERIFY(index);
+
+    // The image changed since it was indexed, the stale entry must not be used
+    ImageData data;
+    data.m_dominant = QColor(Qt::green);
+    QVERIFY(index->contains(QStringLiteral("/images/red.png")));
+    QVERIFY(!index->lookup(QStringLiteral("/images/red.png"), 3, data));
+    QCOMPARE(data.m_dominant, QColor(Qt::green));
+    QVERIFY(data.m_palette.isEmpty());
+}
+
+void PaletteIndexTest::truncatedHeader_data()
+{
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("empty") << 0;
+    QTest::newRow("magic only") << 4;
+    QTest::newRow("without counts") << 8;
+    QTest::newRow("without color count") << 12;
+    QTest::newRow("header only") << s_headerSize;
+    QTest::newRow("partial entry") << s_headerSize + 20;
+}
+
+void PaletteIndexTest::truncatedHeader()
+{
+    QFETCH(int, size);
+
+    const QString fileName = writeIndex(QStringLiteral("complete.kpal"));
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+
+    QFile truncated(m_dir.filePath(QStringLiteral("truncated-%1.kpal").arg(size)));
+    QVERIFY(truncated.open(QIODevice::WriteOnly));
+    truncated.write(file.read(size));
+    truncated.close();
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("(Invalid|Truncated) palette index")));
+    QVERIFY(!PaletteIndex::open(truncated.fileName()));
+}
+
+void PaletteIndexTest::colorsPastEnd_data()
+{
+    QTest::addColumn<int>("offset");
+    QTest::addColumn<quint32>("value");
+
+    // Both entries have three colors in total
+    QTest::newRow("firstColor past end") << s_firstColorOffset << quint32(3);
+    QTest::newRow("colorCount past end") << s_colorCountOffset << quint32(4);
+    QTest::newRow("firstColor wrapping around") << s_firstColorOffset << quint32(0xffffffff);
+    QTest::newRow("colorCount wrapping around") << s_colorCountOffset << quint32(0xffffffff);
+}
+
+void PaletteIndexTest::colorsPastEnd()
+{
+    QFETCH(int, offset);
+    QFETCH(quint32, value);
+
+    const QString fileName = writeIndex(QStringLiteral("colors.kpal"));
+    const QString patched = patchIndex(fileName, QStringLiteral("colors-%1-%2.kpal").arg(offset).arg(value), offset, value);
+    QVERIFY(!patched.isEmpty());
+
+    const auto index = PaletteIndex::open(patched);
+    QVERIFY(index);
+
+    // Entries are sorted by path hash, so patch whichever comes first
+    int patchedEntries = 0;
+    for (const auto &entry : {qMakePair(QStringLiteral("/images/red.png"), 1), qMakePair(QStringLiteral("/images/blue.jpg"), 2)}) {
+        ImageData data;
+        if (!index->lookup(entry.first, entry.second, data)) {
+            ++patchedEntries;
+            QVERIFY(data.m_palette.isEmpty());
+        }
+    }
+    QCOMPARE(patchedEntries, 1);
+}
+
+QTEST_GUILESS_MAIN(PaletteIndexTest)
+
+#include "paletteindextest.moc"
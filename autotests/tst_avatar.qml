@@ -5,8 +5,26 @@ import QtTest 1.0
 
 Kirigami.PageRow {
     id: root
+
+    Kirigami.Avatar {
+        id: avatar
+        width: 64
+        height: 64
+        name: "Nate Martin"
+    }
+
     TestCase {
         name: "AvatarTests"
+        when: windowShown
+
+        function test_rounded_without_layer() {
+            compare(avatar.contentItem.layer.enabled, false)
+            compare(avatar.contentItem.radius, 32)
+
+            avatar.border.width = 2
+            compare(avatar.contentItem.border.width, 2)
+            avatar.border.width = 0
+        }
         function test_latin_name() {
             compare(Kirigami.NameUtils.isStringUnsuitableForInitials("Nate Martin"), false)
             compare(Kirigami.NameUtils.initialsFromString("Nate Martin"), "NM")
@@ -0,0 +1,51 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import org.kde.kirigami 2.19 as Kirigami
+import QtTest 1.0
+
+TestCase {
+    id: testCase
+    name: "ColumnViewTests"
+    width: 200
+    height: 200
+    visible: true
+    when: windowShown
+
+    Kirigami.ColumnView {
+        id: view
+        anchors.fill: parent
+        columnResizeMode: Kirigami.ColumnView.FixedColumns
+        columnWidth: 100
+        freezeColumnsDuringSlide: true
+
+        Rectangle { id: column0; color: "red" }
+        Rectangle { id: column1; color: "green" }
+        Rectangle { id: column2; color: "blue" }
+        Rectangle { id: column3; color: "magenta" }
+    }
+
+    function colorAt(item) {
+        const center = item.mapToItem(view, item.width / 2, item.height / 2)
+        return grabImage(view).pixel(center.x, center.y)
+    }
+
+    function test_columnsRestoredAfterSlide() {
+        view.scrollDuration = 200
+        view.currentIndex = 3
+        tryVerify(() => Qt.colorEqual(colorAt(column3), column3.color))
+
+        // Column 2 was shown as a snapshot during the slide, it must be live again
+        column2.color = "yellow"
+        tryVerify(() => Qt.colorEqual(colorAt(column2), "yellow"))
+
+        view.currentIndex = 0
+        tryVerify(() => Qt.colorEqual(colorAt(column0), column0.color))
+        column1.color = "cyan"
+        tryVerify(() => Qt.colorEqual(colorAt(column1), "cyan"))
+    }
+}
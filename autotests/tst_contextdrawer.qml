@@ -0,0 +1,115 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import QtTest 1.0
+import org.kde.kirigami 2.19 as Kirigami
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
+
+import "../src/controls/private" as ControlsPrivate
+
+TestCase {
+    id: testCase
+    name: "ContextDrawerTests"
+    width: 400
+    height: 400
+    visible: true
+    when: windowShown
+
+    // Stands in for the ContextDrawer the delegates expect to be in
+    QtObject {
+        id: root
+        property bool collapsed: false
+        property bool drawerOpen: true
+    }
+
+    Kirigami.Action {
+        id: first
+        text: "First"
+        checkable: true
+        property int triggerCount: 0
+        onTriggered: triggerCount++
+    }
+    Kirigami.Action {
+        id: second
+        text: "Second"
+        expandible: true
+        Kirigami.Action { id: child1; text: "Child 1" }
+        Kirigami.Action { id: child2; text: "Child 2" }
+    }
+    Kirigami.Action { id: third; text: "Third"; visible: false }
+
+    ListView {
+        id: view
+        width: testCase.width
+        height: testCase.height
+        model: KirigamiPrivate.ActionTreeModel {
+            id: actionsModel
+            actions: [first, second, third]
+            active: true
+        }
+        delegate: ControlsPrivate.ContextDrawerActionItem {
+            width: view.width
+            modelAction: model.action
+        }
+    }
+
+    SignalSpy {
+        id: countSpy
+        target: actionsModel
+        signalName: "countChanged"
+    }
+
+    function init() {
+        actionsModel.actions = [first, second, third]
+        first.checked = false
+        first.triggerCount = 0
+        third.visible = false
+        child2.visible = true
+        actionsModel.active = true
+    }
+
+    function test_rows() {
+        compare(actionsModel.count, 4)
+        verify(actionsModel.hasVisibleActions)
+        tryCompare(view, "count", 4)
+        compare(view.itemAtIndex(0).modelAction, first)
+        compare(view.itemAtIndex(1).modelAction, second)
+        compare(view.itemAtIndex(2).modelAction, child1)
+        compare(view.itemAtIndex(3).modelAction, child2)
+
+        third.visible = true
+        compare(actionsModel.count, 5)
+        child2.visible = false
+        compare(actionsModel.count, 4)
+    }
+
+    function test_countChanged() {
+        countSpy.clear()
+        actionsModel.actions = [second, first, third]
+        compare(actionsModel.count, 4)
+        compare(countSpy.count, 0)
+
+        third.visible = true
+        compare(actionsModel.count, 5)
+        compare(countSpy.count, 1)
+    }
+
+    function test_inactive() {
+        actionsModel.active = false
+        compare(actionsModel.count, 0)
+        verify(actionsModel.hasVisibleActions)
+        actionsModel.active = true
+        compare(actionsModel.count, 4)
+    }
+
+    function test_triggerOnce() {
+        tryVerify(() => view.itemAtIndex(0) !== null)
+        mouseClick(view.itemAtIndex(0))
+        compare(first.triggerCount, 1)
+        verify(first.checked)
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import QtTest 1.0
+
+import "../src/controls/templates/private" as TemplatesPrivate
+
+// Also run with QT_QUICK_BACKEND=software, to cover the fallback.
+TestCase {
+    id: testCase
+    name: "DrawerHandleIconTests"
+    width: 200
+    height: 100
+    visible: true
+    when: windowShown
+
+    Rectangle {
+        anchors.fill: parent
+        color: "white"
+    }
+
+    Row {
+        TemplatesPrivate.MenuIcon {
+            id: menuIcon
+            height: 48
+            color: "black"
+        }
+        TemplatesPrivate.ContextIcon {
+            id: contextIcon
+            height: 48
+            color: "black"
+        }
+    }
+
+    function darkPixels(item) {
+        const image = grabImage(item)
+        let pixels = []
+        for (let y = 0; y < image.height; ++y) {
+            for (let x = 0; x < image.width; ++x) {
+                if (image.pixel(x, y).r < 0.5) {
+                    pixels.push(x + "," + y)
+                }
+            }
+        }
+        return pixels.join(" ")
+    }
+
+    function test_render_data() {
+        return [
+            {tag: "menu", icon: menuIcon},
+            {tag: "context", icon: contextIcon},
+        ]
+    }
+
+    function test_render(data) {
+        // The handle icon item drawing the bars
+        const handleIcon = data.icon.children[0]
+        verify(handleIcon)
+
+        let rendered = []
+        for (const position of [0, 0.25, 0.5, 0.75, 1]) {
+            handleIcon.position = position
+            const pixels = darkPixels(data.icon)
+            verify(pixels.length > 0, "nothing rendered at position " + position)
+            rendered.push(pixels)
+        }
+
+        // The icon morphs while the position changes
+        verify(rendered[0] !== rendered[2])
+        verify(rendered[2] !== rendered[4])
+        verify(rendered[0] !== rendered[4])
+
+        // And is the same again once back at the start
+        handleIcon.position = 0
+        compare(darkPixels(data.icon), rendered[0])
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import QtTest 1.0
+import org.kde.kirigami 2.19 as Kirigami
+
+TestCase {
+    id: testCase
+    name: "HeroTests"
+    width: 400
+    height: 400
+    visible: true
+    when: windowShown
+
+    Rectangle {
+        id: from
+        x: 10
+        y: 10
+        width: 50
+        height: 50
+        color: "red"
+    }
+
+    Rectangle {
+        id: to
+        x: 200
+        y: 200
+        width: 150
+        height: 150
+        color: "blue"
+    }
+
+    Kirigami.Hero {
+        id: hero
+        source: from
+        destination: to
+        duration: 200
+    }
+
+    SignalSpy {
+        id: finishedSpy
+        signalName: "finished"
+    }
+
+    function initTestCase() {
+        finishedSpy.target = findChild(hero, "heroTransition")
+        verify(finishedSpy.target)
+    }
+
+    function init() {
+        hero.restore = true
+        from.opacity = 1
+        to.opacity = 1
+        finishedSpy.clear()
+    }
+
+    function pixelColor(x, y) {
+        return grabImage(testCase).pixel(x, y)
+    }
+
+    function test_restore() {
+        hero.open()
+        finishedSpy.wait()
+        compare(finishedSpy.count, 1)
+
+        compare(from.opacity, 1)
+        compare(to.opacity, 1)
+        // The snapshots don't hide the ends anymore
+        tryVerify(() => Qt.colorEqual(pixelColor(35, 35), "red"))
+        tryVerify(() => Qt.colorEqual(pixelColor(275, 275), "blue"))
+    }
+
+    function test_noRestore() {
+        hero.restore = false
+        hero.open()
+        finishedSpy.wait()
+        compare(from.opacity, 0)
+        compare(to.opacity, 1)
+
+        hero.close()
+        finishedSpy.wait()
+        compare(finishedSpy.count, 2)
+        compare(from.opacity, 1)
+        compare(to.opacity, 0)
+    }
+
+    function test_maskProgress() {
+        hero.open()
+        tryVerify(() => hero.mask.sourceProgress > 0 && hero.mask.sourceProgress < 1)
+        compare(hero.mask.destinationProgress, 1 - hero.mask.sourceProgress)
+        finishedSpy.wait()
+        compare(hero.mask.sourceProgress, 1)
+        compare(hero.mask.destinationProgress, 0)
+    }
+}
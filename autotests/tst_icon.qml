@@ -5,6 +5,7 @@
  */
 
 import QtQuick 2.12
+import QtQuick.Window 2.12
 import QtTest 1.0
 import org.kde.kirigami 2.11 as Kirigami
 
@@ -23,6 +24,7 @@ TestCase {
     Component { id: sizeOnlyIcon; Kirigami.Icon { width: 50; height: 50 } }
     Component { id: sizeSourceIcon; Kirigami.Icon { width: 50; height: 50; source: "document-new" } }
     Component { id: minimalSizeIcon; Kirigami.Icon { width: 1; height: 1; source: "document-new" } }
+    Component { id: distanceFieldIcon; Kirigami.Icon { width: 50; height: 50; source: "document-new"; isMask: true; renderMode: Kirigami.Icon.DistanceField } }
 
     function test_create_data() {
         return [
@@ -30,7 +32,8 @@ TestCase {
             { tag: "Source Only", component: sourceOnlyIcon },
             { tag: "Size Only", component: sizeOnlyIcon },
             { tag: "Size & Source", component: sizeSourceIcon },
-            { tag: "Minimal Size", component: minimalSizeIcon }
+            { tag: "Minimal Size", component: minimalSizeIcon },
+            { tag: "Distance Field", component: distanceFieldIcon }
         ]
     }
 
@@ -42,4 +45,53 @@ TestCase {
         verify(icon)
         verify(waitForRendering(icon))
     }
+
+    Component {
+        id: iconWindow
+        Window {
+            width: 200
+            height: 200
+            visible: true
+
+            Grid {
+                anchors.fill: parent
+                columns: 8
+                Repeater {
+                    model: 64
+                    Kirigami.Icon {
+                        width: 16 + (index % 4) * 8
+                        height: width
+                        source: index % 2 ? "document-new" : "edit-delete"
+                        renderMode: index % 3 == 0 ? Kirigami.Icon.DistanceField : Kirigami.Icon.Default
+                    }
+                }
+            }
+        }
+    }
+
+    // Icons in many windows share textures per window, which with the
+    // threaded render loop means from many render threads at once. Windows
+    // going away or losing their scene graph while others keep rendering
+    // should not disturb the others.
+    function test_manyWindows() {
+        let windows = []
+        for (let i = 0; i < 8; ++i) {
+            windows.push(createTemporaryObject(iconWindow, testCase))
+        }
+
+        for (let round = 0; round < 3; ++round) {
+            for (let window of windows) {
+                verify(waitForRendering(window.contentItem))
+            }
+
+            windows[round].destroy()
+            windows[round] = createTemporaryObject(iconWindow, testCase)
+            windows[round + 4].visible = false
+            windows[round + 4].visible = true
+        }
+
+        for (let window of windows) {
+            verify(waitForRendering(window.contentItem))
+        }
+    }
 }
@@ -0,0 +1,85 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import org.kde.kirigami 2.19 as Kirigami
+import QtTest 1.0
+
+TestCase {
+    id: testCase
+    name: "NavigationTabBarTests"
+    width: 400
+    height: 400
+    visible: true
+    when: windowShown
+
+    Kirigami.Action { id: first; text: "First" }
+    Kirigami.Action { id: second; text: "Second" }
+    Kirigami.Action { id: third; text: "Third"; visible: false }
+    Kirigami.Action { id: fourth; text: "Fourth" }
+
+    Kirigami.NavigationTabBar {
+        id: tabBar
+        width: testCase.width
+        actions: [first, second, third]
+    }
+
+    function init() {
+        tabBar.actions = [first, second, third]
+        tabBar.currentIndex = -1
+        tryCompare(tabBar, "count", 3)
+    }
+
+    function test_currentIndex() {
+        compare(tabBar.count, 3)
+        compare(tabBar.currentIndex, -1)
+
+        tabBar.currentIndex = 1
+        verify(second.checked)
+        compare(tabBar.currentIndex, 1)
+
+        first.trigger()
+        compare(tabBar.currentIndex, 0)
+        verify(!second.checked)
+
+        tabBar.currentIndex = 5
+        compare(tabBar.currentIndex, 0)
+    }
+
+    function test_tabGroup() {
+        compare(tabBar.tabGroup.buttons.length, 3)
+        compare(tabBar.tabGroup.checkedButton, null)
+
+        tabBar.currentIndex = 1
+        compare(tabBar.tabGroup.checkedButton, tabBar.contentItem.tabs[1])
+
+        tabBar.actions = [first, second]
+        tryCompare(tabBar, "count", 2)
+        tryVerify(() => tabBar.tabGroup.buttons.length === 2)
+    }
+
+    function test_equalWidths() {
+        const tabs = tabBar.contentItem.tabs
+        verify(tabs[0].width > 0)
+        compare(tabs[0].width, tabs[1].width)
+        compare(tabs[1].x, tabs[0].x + tabs[0].width + tabBar.spacing)
+        verify(!tabs[2].visible)
+    }
+
+    function test_reuseTabs() {
+        const firstTab = tabBar.contentItem.tabs[0]
+        const secondTab = tabBar.contentItem.tabs[1]
+        const thirdTab = tabBar.contentItem.tabs[2]
+
+        tabBar.actions = [second, fourth]
+        tryCompare(tabBar, "count", 2)
+        compare(tabBar.contentItem.tabs[0], secondTab)
+        compare(tabBar.contentItem.tabs[0].tabIndex, 0)
+        // The tab of a removed action is used for the new one
+        verify(tabBar.contentItem.tabs[1] === firstTab || tabBar.contentItem.tabs[1] === thirdTab)
+        compare(tabBar.contentItem.tabs[1].action, fourth)
+    }
+}
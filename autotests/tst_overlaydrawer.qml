@@ -0,0 +1,66 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import org.kde.kirigami 2.19 as Kirigami
+import QtTest 1.0
+
+TestCase {
+    id: testCase
+    name: "OverlayDrawerTests"
+    when: windowShown
+
+    property var positions: []
+
+    Kirigami.ApplicationWindow {
+        id: window
+        width: 400
+        height: 400
+        visible: true
+
+        globalDrawer: Kirigami.OverlayDrawer {
+            id: drawer
+            modal: true
+            onPositionChanged: testCase.positions.push(position)
+        }
+    }
+
+    function init() {
+        drawer.close()
+        tryCompare(drawer, "position", 0)
+        positions = []
+    }
+
+    function isIntermediate(position) {
+        return position > 0 && position < 1
+    }
+
+    function test_open() {
+        drawer.open()
+        tryVerify(() => drawer.animating)
+        tryCompare(drawer, "position", 1)
+        tryVerify(() => !drawer.animating)
+        verify(positions.some(isIntermediate))
+        // The position only ever grows while opening
+        for (let i = 1; i < positions.length; ++i) {
+            verify(positions[i] >= positions[i - 1])
+        }
+    }
+
+    function test_close() {
+        drawer.open()
+        tryCompare(drawer, "position", 1)
+        tryVerify(() => !drawer.animating)
+        positions = []
+
+        drawer.close()
+        tryCompare(drawer, "position", 0)
+        verify(positions.some(isIntermediate))
+        for (let i = 1; i < positions.length; ++i) {
+            verify(positions[i] <= positions[i - 1])
+        }
+    }
+}
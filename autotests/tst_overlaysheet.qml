@@ -0,0 +1,147 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import QtQuick.Controls 2.15 as QQC2
+import QtTest 1.0
+import org.kde.kirigami 2.19 as Kirigami
+
+TestCase {
+    id: testCase
+    name: "OverlaySheetTests"
+    width: 400
+    height: 600
+    visible: true
+    when: windowShown
+
+    property int shortDuration
+    property int longDuration
+    property Item sheetLayout
+
+    ListModel {
+        id: listModel
+    }
+
+    Kirigami.OverlaySheet {
+        id: sheet
+        parent: testCase
+
+        header: Kirigami.Heading {
+            id: sheetHeader
+            text: "Header"
+        }
+        footer: QQC2.Label {
+            id: sheetFooter
+            text: "Footer"
+        }
+
+        ListView {
+            id: list
+            implicitWidth: 300
+            model: listModel
+            delegate: Rectangle {
+                width: list.width
+                height: 40
+                color: "red"
+            }
+        }
+    }
+
+    SignalSpy {
+        id: repositionSpy
+        signalName: "repositionRequested"
+    }
+
+    function initTestCase() {
+        // Settle size changes within a frame, instead of animating them
+        shortDuration = Kirigami.Units.shortDuration
+        longDuration = Kirigami.Units.longDuration
+        Kirigami.Units.shortDuration = 0
+        Kirigami.Units.longDuration = 0
+
+        sheetLayout = findChild(sheet.rootItem, "sheetLayout")
+        verify(sheetLayout)
+        repositionSpy.target = sheetLayout
+    }
+
+    function cleanupTestCase() {
+        Kirigami.Units.shortDuration = shortDuration
+        Kirigami.Units.longDuration = longDuration
+    }
+
+    function init() {
+        setRows(3)
+        sheet.open()
+        tryVerify(centered)
+    }
+
+    function cleanup() {
+        sheet.close()
+        tryCompare(sheet.rootItem, "visible", false)
+    }
+
+    function setRows(count) {
+        while (listModel.count > count) {
+            listModel.remove(listModel.count - 1)
+        }
+        while (listModel.count < count) {
+            listModel.append({})
+        }
+    }
+
+    function sheetRect() {
+        const contentLayout = sheetLayout.sheet
+        return contentLayout.mapToItem(testCase, 0, 0, contentLayout.width, contentLayout.height)
+    }
+
+    function centered() {
+        const rect = sheetRect()
+        return rect.height > 0 && Math.abs(rect.y + rect.height / 2 - testCase.height / 2) <= 2
+    }
+
+    function test_centered() {
+        const rect = sheetRect()
+        verify(rect.height < testCase.height)
+        compare(rect.x + rect.width / 2, testCase.width / 2)
+
+        setRows(6)
+        tryVerify(() => sheetRect().height > rect.height)
+        tryVerify(centered)
+    }
+
+    function test_singleReposition() {
+        // Rows are removed and added one by one, like a filter does
+        repositionSpy.clear()
+        setRows(1)
+        tryVerify(centered)
+        wait(50)
+        compare(repositionSpy.count, 1)
+
+        repositionSpy.clear()
+        setRows(8)
+        tryVerify(centered)
+        wait(50)
+        compare(repositionSpy.count, 1)
+    }
+
+    function test_headerAndFooter() {
+        const rect = sheetRect()
+        const header = sheetHeader.mapToItem(testCase, 0, 0, sheetHeader.width, sheetHeader.height)
+        const footer = sheetFooter.mapToItem(testCase, 0, 0, sheetFooter.width, sheetFooter.height)
+        const content = list.mapToItem(testCase, 0, 0, list.width, list.height)
+
+        verify(header.width > 0 && header.height > 0)
+        verify(footer.width > 0 && footer.height > 0)
+
+        // Header above the content, footer below it, both inside the sheet
+        verify(header.x >= rect.x && header.x + header.width <= rect.x + rect.width)
+        verify(header.y >= rect.y)
+        verify(header.y + header.height <= content.y)
+        verify(footer.x >= rect.x && footer.x + footer.width <= rect.x + rect.width)
+        verify(footer.y >= content.y + content.height)
+        verify(footer.y + footer.height <= rect.y + rect.height)
+    }
+}
@@ -57,6 +57,99 @@ Kirigami.PageRow {
             compare(router.currentRoutes().length, 1)
             compare(router.pageStack.count, 1)
         }
+        function test_k_route_string() {
+            router.navigateToRoute("home/login?data=red&title=Login")
+            compare(router.currentRoutes().length, 2)
+            compare(router.routeActive(["home", {"route": "login", "data": "red"}]), true)
+            compare(router.currentRoutes()[1].title, "Login")
+            router.pushRoute("login?data=blue")
+            compare(router.currentRoutes().length, 3)
+            compare(router.routeActive("home/login?data=red/login?data=blue"), true)
+            router.navigateToRoute("home")
+            compare(router.currentRoutes().length, 1)
+        }
+        function test_l_single_route_string() {
+            router.navigateToRoute(["home", {"route": "login", "data": "red"}])
+            router.bringToView("home")
+            compare(root.columnView.currentIndex, 0)
+            router.bringToView("login?data=red")
+            compare(root.columnView.currentIndex, 1)
+            router.bringToView("home")
+
+            // A path is not a single route, the last segment must not be picked silently
+            ignoreWarning(/Expected a single route, but "home\/login\?data=red" is a path of 2 routes/)
+            ignoreWarning(/is not on the current stack of routes/)
+            router.bringToView("home/login?data=red")
+            compare(root.columnView.currentIndex, 0)
+            router.navigateToRoute("home")
+        }
+        function test_m_declared_properties() {
+            router.navigateToRoute(["home", {"route": "properties", "data": "m", "label": "declared"}])
+            let page = root.columnView.contentChildren[1]
+            compare(page.label, "declared")
+            compare(page.boundLabel, "declared bound")
+
+            // Route properties are initial properties, they replace the page's own bindings
+            router.navigateToRoute(["home", {"route": "properties", "data": "m2", "boundLabel": "explicit"}])
+            page = root.columnView.contentChildren[1]
+            compare(page.label, "default")
+            compare(page.boundLabel, "explicit")
+            page.label = "changed"
+            compare(page.boundLabel, "explicit")
+            router.navigateToRoute("home")
+        }
+        function test_n_dynamic_properties() {
+            router.navigateToRoute(["home", {"route": "properties", "data": "n", "label": "declared", "undeclared": "dynamic"}])
+            compare(router.currentRoutes().length, 2)
+            compare(root.columnView.contentChildren[1].label, "declared")
+            compare(router.currentRoutes()[1].undeclared, "dynamic")
+            compare(router.params.undeclared, "dynamic")
+            router.navigateToRoute("home")
+        }
+        function test_o_cached_push() {
+            router.navigateToRoute(["home", {"route": "properties", "data": "o", "label": "first"}])
+            const page = root.columnView.contentChildren[1]
+            compare(page.label, "first")
+            router.navigateToRoute("home")
+
+            // The cached page is reused, with the properties of the new route
+            router.navigateToRoute(["home", {"route": "properties", "data": "o", "label": "second", "undeclared": "dynamic"}])
+            compare(root.columnView.contentChildren[1], page)
+            compare(page.label, "second")
+            compare(router.params.undeclared, "dynamic")
+            router.navigateToRoute("home")
+        }
+        function test_p_appended_routes() {
+            router.navigateToRoute(["home", {"route": "properties", "data": "p", "label": "before"}])
+            compare(root.columnView.contentChildren[1].label, "before")
+            router.navigateToRoute("home")
+
+            const appended = Qt.createQmlObject(`
+                import QtQuick 2.12
+                import org.kde.kirigami 2.12 as Kirigami
+                Kirigami.PageRoute {
+                    name: "appended"
+                    Component {
+                        Kirigami.Page {
+                            property int first: 1
+                            property string label: "default"
+                        }
+                    }
+                }`, router)
+            let routes = []
+            for (let i = 0; i < router.routes.length; ++i) {
+                routes.push(router.routes[i])
+            }
+            routes.push(appended)
+            router.routes = routes
+
+            router.navigateToRoute(["home", {"route": "appended", "label": "appended"}])
+            compare(root.columnView.contentChildren[1].label, "appended")
+            compare(root.columnView.contentChildren[1].first, 1)
+            router.navigateToRoute(["home", {"route": "properties", "data": "p2", "label": "after"}])
+            compare(root.columnView.contentChildren[1].label, "after")
+            router.navigateToRoute("home")
+        }
     }
     Kirigami.PageRouter {
         id: router
@@ -106,5 +199,15 @@ Kirigami.PageRow {
                 }
             }
         }
+        Kirigami.PageRoute {
+            name: "properties"
+            cache: true
+            Component {
+                Kirigami.Page {
+                    property string label: "default"
+                    property string boundLabel: label + " bound"
+                }
+            }
+        }
     }
 }
\ No newline at end of file
@@ -128,4 +128,72 @@ TestCase {
         spyDestructions.wait()
         compare(testCase.destructions, 2)
     }
+
+    function test_dialogLayerRecycling() {
+        mainWindow.pageStack.dialogPoolSize = 1
+        destructions = 0
+
+        let page = mainWindow.pageStack.pushDialogLayer(destroyedPage)
+        verify(page)
+        page.closeDialog()
+        tryCompare(testCase, "destructions", 1)
+
+        // the window has been recycled, pushing again only creates the page
+        page = mainWindow.pageStack.pushDialogLayer(destroyedPage)
+        verify(page)
+        page.closeDialog()
+        tryCompare(testCase, "destructions", 2)
+
+        mainWindow.pageStack.dialogPoolSize = 0
+    }
+
+    function test_dialogLayerWindowProperties() {
+        mainWindow.pageStack.dialogPoolSize = 1
+
+        let page = mainWindow.pageStack.pushDialogLayer(destroyedPage, {}, {title: "First", minimumWidth: Kirigami.Units.gridUnit * 30})
+        const window = page.Window.window
+        compare(window.title, "First")
+        compare(window.minimumWidth, Kirigami.Units.gridUnit * 30)
+        page.closeDialog()
+        tryVerify(() => !window.visible)
+
+        // The recycled window doesn't keep the properties of the previous call
+        page = mainWindow.pageStack.pushDialogLayer(destroyedPage)
+        compare(page.Window.window, window)
+        verify(window.title !== "First")
+        compare(window.minimumWidth, Kirigami.Units.gridUnit * 20)
+        page.closeDialog()
+
+        mainWindow.pageStack.dialogPoolSize = 0
+    }
+
+    property int creations: 0
+    Component {
+        id: countedPage
+        Kirigami.Page {
+            Component.onCompleted: testCase.creations++
+        }
+    }
+
+    function test_restore() {
+        creations = 0
+        let pages = []
+        for (let i = 0; i < 10; ++i) {
+            pages.push({page: countedPage, properties: {title: "Page " + i}})
+        }
+
+        const current = mainWindow.pageStack.restore(pages)
+        compare(mainWindow.pageStack.depth, 10)
+        compare(mainWindow.pageStack.currentIndex, 9)
+        compare(current, mainWindow.pageStack.currentItem)
+        compare(current.title, "Page 9")
+        // Only the pages around the current one have been created
+        verify(creations < 10)
+        compare(mainWindow.pageStack.get(2).title, "Page 2")
+
+        mainWindow.pageStack.currentIndex = 2
+        tryVerify(() => !mainWindow.pageStack.currentItem.__isPagePlaceholder)
+        compare(mainWindow.pageStack.currentItem.title, "Page 2")
+        verify(creations < 10)
+    }
 }
@@ -0,0 +1,75 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.12
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
+import QtTest 1.0
+
+TestCase {
+    name: "PassiveNotificationModelTests"
+
+    KirigamiPrivate.PassiveNotificationModel {
+        id: notifications
+        maximumCount: 3
+    }
+
+    function cleanup() {
+        notifications.clear()
+        notifications.paused = false
+    }
+
+    function test_coalesce() {
+        notifications.post("Saved", 5000)
+        notifications.post("Saved", 5000)
+        notifications.post("Saved", 5000)
+        compare(notifications.count, 1)
+
+        notifications.post("Saved", 5000, "Undo")
+        compare(notifications.count, 2)
+    }
+
+    function test_newest_first() {
+        notifications.post("First", 5000)
+        notifications.post("Second", 5000)
+        notifications.post("First", 5000)
+        compare(notifications.count, 2)
+        compare(notifications.data(notifications.index(0, 0)), "First")
+    }
+
+    function test_maximum_count() {
+        for (let i = 0; i < 5; ++i) {
+            notifications.post("Message " + i, 5000)
+        }
+        compare(notifications.count, 3)
+        compare(notifications.data(notifications.index(0, 0)), "Message 4")
+        compare(notifications.data(notifications.index(2, 0)), "Message 2")
+    }
+
+    function test_expiry() {
+        notifications.post("Short", 50)
+        notifications.post("Long", 5000)
+        tryCompare(notifications, "count", 1)
+        compare(notifications.data(notifications.index(0, 0)), "Long")
+    }
+
+    function test_paused() {
+        notifications.paused = true
+        notifications.post("Paused", 50)
+        wait(200)
+        compare(notifications.count, 1)
+
+        notifications.paused = false
+        tryCompare(notifications, "count", 0)
+    }
+
+    function test_trigger() {
+        let triggered = false
+        notifications.post("With action", 5000, "Undo", function() { triggered = true })
+        notifications.trigger(0)
+        verify(triggered)
+        compare(notifications.count, 0)
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import QtQuick.Window 2.15
+import QtTest 1.0
+import org.kde.kirigami 2.19 as Kirigami
+
+TestCase {
+    id: testCase
+    name: "ShadowedRectangleTests"
+    width: 200
+    height: 200
+    visible: true
+    when: windowShown
+
+    Rectangle {
+        anchors.fill: parent
+        color: "white"
+    }
+
+    Kirigami.ShadowedRectangle {
+        id: rectangle
+        x: 50
+        y: 50
+        width: 100
+        height: 100
+        color: "red"
+        shadow.color: "black"
+    }
+
+    // Only the scene graph renderer draws shadows
+    readonly property bool hasShadows: GraphicsInfo.api !== GraphicsInfo.Software
+
+    function init() {
+        rectangle.color = "red"
+        rectangle.shadow.size = 0
+        rectangle.border.width = 0
+        rectangle.border.color = "lime"
+    }
+
+    function fuzzyEqual(actual, expected) {
+        // Turns color names into colors
+        expected = Qt.darker(expected, 1.0)
+        return Math.abs(actual.r - expected.r) < 0.05
+            && Math.abs(actual.g - expected.g) < 0.05
+            && Math.abs(actual.b - expected.b) < 0.05
+    }
+
+    function verifyPixel(x, y, expected) {
+        tryVerify(() => fuzzyEqual(grabImage(testCase).pixel(x, y), expected), 5000,
+                  "pixel at %1,%2 should be %3".arg(x).arg(y).arg(expected))
+    }
+
+    function verifyShadow(x, y) {
+        // Darker than the background, not the rectangle itself
+        tryVerify(() => {
+            const pixel = grabImage(testCase).pixel(x, y)
+            return pixel.r < 0.95 && Math.abs(pixel.r - pixel.g) < 0.05
+        }, 5000, "pixel at %1,%2 should be in the shadow".arg(x).arg(y))
+    }
+
+    function test_color() {
+        verifyPixel(100, 100, "red")
+        rectangle.color = "blue"
+        verifyPixel(100, 100, "blue")
+        verifyPixel(40, 100, "white")
+    }
+
+    function test_shadowSize() {
+        if (!hasShadows) {
+            skip("Shadows are not drawn by the software renderer")
+        }
+
+        verifyPixel(40, 100, "white")
+
+        // The geometry needs to grow to make room for the shadow
+        rectangle.shadow.size = 30
+        verifyShadow(40, 100)
+        verifyPixel(100, 100, "red")
+
+        rectangle.shadow.size = 0
+        verifyPixel(40, 100, "white")
+    }
+
+    function test_borderWidth() {
+        verifyPixel(52, 100, "red")
+
+        // Swaps to the border material
+        rectangle.border.width = 6
+        verifyPixel(52, 100, "lime")
+        verifyPixel(100, 100, "red")
+
+        // Values set while the other material is in use must not get lost
+        rectangle.color = "blue"
+        verifyPixel(100, 100, "blue")
+        if (hasShadows) {
+            rectangle.shadow.size = 30
+            verifyShadow(40, 100)
+        }
+
+        rectangle.border.width = 0
+        verifyPixel(52, 100, "blue")
+        verifyPixel(100, 100, "blue")
+        if (hasShadows) {
+            verifyShadow(40, 100)
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import org.kde.kirigami 2.19 as Kirigami
+import QtTest 1.0
+
+TestCase {
+    id: testCase
+    name: "SwipeNavigatorTests"
+    width: 400
+    height: 400
+    visible: true
+    when: windowShown
+
+    Component {
+        id: content
+        Rectangle {}
+    }
+
+    Kirigami.SwipeNavigator {
+        id: navigator
+        anchors.fill: parent
+        asynchronous: false
+
+        Kirigami.LazyPage { id: page0; title: "0"; contentComponent: content }
+        Kirigami.LazyPage { id: page1; title: "1"; contentComponent: content }
+        Kirigami.LazyPage { id: page2; title: "2"; contentComponent: content }
+        Kirigami.LazyPage { id: page3; title: "3"; contentComponent: content }
+    }
+
+    function init() {
+        navigator.retainedPages = 0
+        navigator.currentIndex = 0
+    }
+
+    function test_neighboursLoaded() {
+        verify(page0.contentInstance)
+        verify(page1.contentInstance)
+        verify(!page2.loaded)
+        verify(!page3.loaded)
+
+        navigator.currentIndex = 2
+        verify(!page0.loaded)
+        verify(page1.loaded)
+        verify(page2.contentInstance)
+        verify(page3.loaded)
+    }
+
+    function test_retainedPages() {
+        navigator.retainedPages = 1
+        navigator.currentIndex = 3
+        verify(page0.loaded)
+        verify(!page1.loaded)
+
+        navigator.currentIndex = 1
+        verify(page3.loaded)
+    }
+}
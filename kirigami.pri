@@ -9,6 +9,7 @@ HEADERS     += $$PWD/src/kirigamiplugin.h \
                $$PWD/src/mnemonicattached.h \
                $$PWD/src/scenepositionattached.h \
                $$PWD/src/libkirigami/basictheme_p.h \
+               $$PWD/src/libkirigami/embeddedicons_p.h \
                $$PWD/src/libkirigami/platformtheme.h \
                $$PWD/src/libkirigami/kirigamipluginfactory.h \
                $$PWD/src/libkirigami/tabletmodewatcher.h \
@@ -20,8 +21,16 @@ HEADERS     += $$PWD/src/kirigamiplugin.h \
                $$PWD/src/scenegraph/shadowedrectanglematerial.h \
                $$PWD/src/scenegraph/shadowedtexturematerial.h \
                $$PWD/src/scenegraph/shadowedtexturenode.h \
+               $$PWD/src/scenegraph/distancefieldiconnode.h \
+               $$PWD/src/scenegraph/distancefieldiconmaterial.h \
+               $$PWD/src/scenegraph/drawerhandleiconmaterial.h \
+               $$PWD/src/scenegraph/herotransitionnode.h \
+               $$PWD/src/scenegraph/herotransitionmaterial.h \
                $$PWD/src/icon.h \
+               $$PWD/src/icondistancefield.h \
                $$PWD/src/imagecolors.h \
+               $$PWD/src/palettegenerator.h \
+               $$PWD/src/paletteindex.h \
                $$PWD/src/delegaterecycler.h \
                $$PWD/src/wheelhandler.h \
                $$PWD/src/shadowedrectangle.h \
@@ -30,6 +39,13 @@ HEADERS     += $$PWD/src/kirigamiplugin.h \
                $$PWD/src/pagerouter.h \
                $$PWD/src/pagepool.h \
                $$PWD/src/avatar.h \
+               $$PWD/src/actiontreemodel.h \
+               $$PWD/src/drawerhandleicon.h \
+               $$PWD/src/herotransition.h \
+               $$PWD/src/passivenotificationmodel.h \
+               $$PWD/src/navigationtablayout.h \
+               $$PWD/src/overlaysheetlayout.h \
+               $$PWD/src/pageactioncollector.h \
                $$PWD/src/toolbarlayout.h \
                $$PWD/src/toolbarlayoutdelegate.h \
                $$PWD/src/libkirigami/units.h
@@ -42,6 +58,7 @@ SOURCES     += $$PWD/src/kirigamiplugin.cpp \
                $$PWD/src/mnemonicattached.cpp \
                $$PWD/src/scenepositionattached.cpp \
                $$PWD/src/libkirigami/basictheme.cpp \
+               $$PWD/src/libkirigami/embeddedicons.cpp \
                $$PWD/src/libkirigami/platformtheme.cpp \
                $$PWD/src/libkirigami/kirigamipluginfactory.cpp \
                $$PWD/src/libkirigami/tabletmodewatcher.cpp \
@@ -53,8 +70,16 @@ SOURCES     += $$PWD/src/kirigamiplugin.cpp \
                $$PWD/src/scenegraph/shadowedrectanglematerial.cpp \
                $$PWD/src/scenegraph/shadowedtexturematerial.cpp \
                $$PWD/src/scenegraph/shadowedtexturenode.cpp \
+               $$PWD/src/scenegraph/distancefieldiconnode.cpp \
+               $$PWD/src/scenegraph/distancefieldiconmaterial.cpp \
+               $$PWD/src/scenegraph/drawerhandleiconmaterial.cpp \
+               $$PWD/src/scenegraph/herotransitionnode.cpp \
+               $$PWD/src/scenegraph/herotransitionmaterial.cpp \
                $$PWD/src/icon.cpp \
+               $$PWD/src/icondistancefield.cpp \
                $$PWD/src/imagecolors.cpp \
+               $$PWD/src/palettegenerator.cpp \
+               $$PWD/src/paletteindex.cpp \
                $$PWD/src/delegaterecycler.cpp \
                $$PWD/src/wheelhandler.cpp \
                $$PWD/src/shadowedrectangle.cpp \
@@ -63,6 +88,13 @@ SOURCES     += $$PWD/src/kirigamiplugin.cpp \
                $$PWD/src/pagerouter.cpp \
                $$PWD/src/pagepool.cpp \
                $$PWD/src/avatar.cpp \
+               $$PWD/src/actiontreemodel.cpp \
+               $$PWD/src/drawerhandleicon.cpp \
+               $$PWD/src/herotransition.cpp \
+               $$PWD/src/passivenotificationmodel.cpp \
+               $$PWD/src/navigationtablayout.cpp \
+               $$PWD/src/overlaysheetlayout.cpp \
+               $$PWD/src/pageactioncollector.cpp \
                $$PWD/src/toolbarlayout.cpp \
                $$PWD/src/toolbarlayoutdelegate.cpp \
                $$PWD/src/libkirigami/units.cpp
@@ -3,6 +3,7 @@
 SRC_DIR="src/"
 BREEZEICONS_DIR="breeze-icons"
 ICONS_SIZES=(48 32 22)
+INDEX_FILE="kirigami-icons.index"
 TAB="    "
 
 kirigami_dir="$(cd $(dirname $(readlink -f $0))/.. && pwd)"
@@ -37,6 +38,10 @@ unset IFS
 
 #printf "%s\n" "${icons[@]}"
 
+# generate the index read by Kirigami::EmbeddedIcons, one line per file with
+# icon name, size and path relative to the index, separated by tabs
+echo "# generated by $(basename $0)" > ${INDEX_FILE}
+
 # generate .qrc
 echo "<RCC>"
 echo "${TAB}<qresource prefix=\"/\">"
@@ -47,12 +52,14 @@ for icon in ${icons[@]}; do
 
 		if [[ -n ${file} ]]; then
 			echo -e "${TAB}${TAB}<file alias=\"icons/$(basename ${file})\">${file}</file>"
+			printf "%s\t%s\t%s\n" "${icon}" "${size}" "$(basename ${file})" >> ${INDEX_FILE}
 			#echo ${file}
 			break
 		fi
 	done
 done
 
+echo -e "${TAB}${TAB}<file alias=\"icons/breeze-internal.index\">${INDEX_FILE}</file>"
 echo "${TAB}</qresource>"
 echo "</RCC>"
 
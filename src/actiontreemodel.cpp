@@ -0,0 +1,325 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "actiontreemodel.h"
+
+#include <QJSValue>
+#include <QMetaMethod>
+#include <QQmlListReference>
+
+#include <algorithm>
+
+static QList<QObject *> objectList(const QVariant &value)
+{
+    QList<QObject *> result;
+
+    if (value.userType() == qMetaTypeId<QJSValue>()) {
+        return objectList(value.value<QJSValue>().toVariant());
+    }
+
+    if (value.canConvert<QQmlListReference>()) {
+        const auto reference = value.value<QQmlListReference>();
+        for (int i = 0; i < reference.count(); ++i) {
+            result << reference.at(i);
+        }
+        return result;
+    }
+
+    if (value.canConvert<QVariantList>()) {
+        const auto list = value.value<QVariantList>();
+        for (const auto &item : list) {
+            if (auto object = item.value<QObject *>()) {
+                result << object;
+            }
+        }
+    }
+
+    return result;
+}
+
+static QList<QObject *> childActions(QObject *action)
+{
+    if (action->metaObject()->indexOfProperty("children") < 0) {
+        return {};
+    }
+
+    const QQmlListReference reference(action, "children");
+    if (reference.isValid()) {
+        QList<QObject *> result;
+        for (int i = 0; i < reference.count(); ++i) {
+            result << reference.at(i);
+        }
+        return result;
+    }
+
+    return objectList(action->property("children"));
+}
+
+static bool readVisible(QObject *action)
+{
+    const auto visible = action->property("visible");
+    return visible.isValid() ? visible.toBool() : true;
+}
+
+static bool isExpandible(QObject *action)
+{
+    return action->property("expandible").toBool();
+}
+
+ActionTreeModel::ActionTreeModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+}
+
+ActionTreeModel::~ActionTreeModel()
+{
+}
+
+QVariant ActionTreeModel::actions() const
+{
+    return m_actions;
+}
+
+void ActionTreeModel::setActions(const QVariant &actions)
+{
+    m_actions = actions;
+
+    untrackAll();
+    m_topLevelActions.clear();
+
+    auto list = objectList(actions);
+    if (list.isEmpty()) {
+        // Some users pass a list that contains the list of actions.
+        const auto variants = actions.value<QVariantList>();
+        if (!variants.isEmpty()) {
+            list = objectList(variants.first());
+        }
+    }
+
+    for (auto action : std::as_const(list)) {
+        m_topLevelActions << action;
+        track(action);
+    }
+
+    updateHasVisibleActions();
+    updateRows();
+
+    Q_EMIT actionsChanged();
+}
+
+bool ActionTreeModel::isActive() const
+{
+    return m_active;
+}
+
+void ActionTreeModel::setActive(bool active)
+{
+    if (active == m_active) {
+        return;
+    }
+
+    m_active = active;
+    updateRows();
+    Q_EMIT activeChanged();
+}
+
+bool ActionTreeModel::hasVisibleActions() const
+{
+    return m_hasVisibleActions;
+}
+
+int ActionTreeModel::count() const
+{
+    return m_rows.size();
+}
+
+int ActionTreeModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_rows.size();
+}
+
+QVariant ActionTreeModel::data(const QModelIndex &index, int role) const
+{
+    if (!checkIndex(index, CheckIndexOption::IndexIsValid)) {
+        return QVariant();
+    }
+
+    const auto &row = m_rows.at(index.row());
+    switch (role) {
+    case ActionRole:
+        return QVariant::fromValue(row.action);
+    case DepthRole:
+        return row.depth;
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> ActionTreeModel::roleNames() const
+{
+    return {
+        {ActionRole, "action"},
+        {DepthRole, "depth"},
+    };
+}
+
+void ActionTreeModel::track(QObject *action)
+{
+    if (!action || m_tracked.contains(action)) {
+        return;
+    }
+
+    m_tracked.insert(action);
+    m_visibility.insert(action, readVisible(action));
+
+    static const QMetaMethod changedSlot = staticMetaObject.method(staticMetaObject.indexOfMethod("onActionChanged()"));
+
+    const auto metaObject = action->metaObject();
+    for (auto name : {"visible", "expandible", "children"}) {
+        const int index = metaObject->indexOfProperty(name);
+        if (index < 0) {
+            continue;
+        }
+        const auto property = metaObject->property(index);
+        if (property.hasNotifySignal()) {
+            connect(action, property.notifySignal(), this, changedSlot);
+        }
+    }
+
+    connect(action, &QObject::destroyed, this, &ActionTreeModel::onActionDestroyed);
+}
+
+void ActionTreeModel::untrackAll()
+{
+    for (auto action : std::as_const(m_tracked)) {
+        disconnect(action, nullptr, this, nullptr);
+    }
+    m_tracked.clear();
+    m_visibility.clear();
+}
+
+void ActionTreeModel::onActionChanged()
+{
+    auto action = sender();
+    if (!action) {
+        return;
+    }
+
+    m_visibility.insert(action, readVisible(action));
+    updateHasVisibleActions();
+    updateRows();
+}
+
+void ActionTreeModel::onActionDestroyed(QObject *action)
+{
+    m_tracked.remove(action);
+    m_visibility.remove(action);
+
+    // The rows may still point to the destroyed action, drop them right away.
+    QVector<Row> rows = m_rows;
+    rows.erase(std::remove_if(rows.begin(),
+                              rows.end(),
+                              [action](const Row &row) {
+                                  return row.action == action;
+                              }),
+               rows.end());
+    setRows(rows);
+    updateHasVisibleActions();
+}
+
+bool ActionTreeModel::isVisible(QObject *action) const
+{
+    return m_visibility.value(action, true);
+}
+
+void ActionTreeModel::updateHasVisibleActions()
+{
+    bool hasVisibleActions = false;
+    for (const auto &action : std::as_const(m_topLevelActions)) {
+        if (action && isVisible(action)) {
+            hasVisibleActions = true;
+            break;
+        }
+    }
+
+    if (hasVisibleActions != m_hasVisibleActions) {
+        m_hasVisibleActions = hasVisibleActions;
+        Q_EMIT hasVisibleActionsChanged();
+    }
+}
+
+void ActionTreeModel::updateRows()
+{
+    QVector<Row> rows;
+
+    if (m_active) {
+        for (const auto &action : std::as_const(m_topLevelActions)) {
+            if (!action || !isVisible(action)) {
+                continue;
+            }
+
+            rows << Row{action, 0};
+
+            // Children are only looked at, and tracked, once their parent is
+            // shown expanded.
+            if (isExpandible(action)) {
+                const auto children = childActions(action);
+                for (auto child : children) {
+                    track(child);
+                    if (isVisible(child)) {
+                        rows << Row{child, 1};
+                    }
+                }
+            }
+        }
+    }
+
+    setRows(rows);
+}
+
+void ActionTreeModel::setRows(const QVector<Row> &rows)
+{
+    if (rows == m_rows) {
+        return;
+    }
+
+    const int oldCount = m_rows.size();
+
+    // Only replace the range that differs, a visibility change of a single
+    // action then results in a single insertion or removal.
+    const int common = std::min(rows.size(), m_rows.size());
+    int prefix = 0;
+    while (prefix < common && rows.at(prefix) == m_rows.at(prefix)) {
+        ++prefix;
+    }
+    int suffix = 0;
+    while (suffix < common - prefix && rows.at(rows.size() - 1 - suffix) == m_rows.at(m_rows.size() - 1 - suffix)) {
+        ++suffix;
+    }
+
+    const int removeLast = m_rows.size() - suffix - 1;
+    if (removeLast >= prefix) {
+        beginRemoveRows(QModelIndex(), prefix, removeLast);
+        m_rows.remove(prefix, removeLast - prefix + 1);
+        endRemoveRows();
+    }
+
+    const int insertLast = rows.size() - suffix - 1;
+    if (insertLast >= prefix) {
+        beginInsertRows(QModelIndex(), prefix, insertLast);
+        m_rows = rows;
+        endInsertRows();
+    }
+
+    if (m_rows.size() != oldCount) {
+        Q_EMIT countChanged();
+    }
+}
+
+#include "moc_actiontreemodel.cpp"
@@ -0,0 +1,107 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QPointer>
+#include <QSet>
+#include <QVector>
+
+/**
+ * A flat model of visible actions, with the children of expandible actions
+ * listed below their parent.
+ *
+ * Rows are only built while the model is active, so a view that is not shown,
+ * such as a closed ContextDrawer, does not pay for walking the action tree
+ * every time the actions change. Visibility of actions is tracked through
+ * their change signals, a change only inserts or removes the affected rows.
+ */
+class ActionTreeModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    /**
+     * The actions to show. This can be a list property, such as
+     * Page::contextualActions, or a JavaScript array of actions.
+     */
+    Q_PROPERTY(QVariant actions READ actions WRITE setActions NOTIFY actionsChanged)
+
+    /**
+     * Whether the rows of this model are built. While not active the model is
+     * empty, only hasVisibleActions is kept up to date.
+     */
+    Q_PROPERTY(bool active READ isActive WRITE setActive NOTIFY activeChanged)
+
+    /**
+     * Whether any of the top level actions is visible.
+     */
+    Q_PROPERTY(bool hasVisibleActions READ hasVisibleActions NOTIFY hasVisibleActionsChanged)
+
+    /**
+     * The number of rows in this model.
+     */
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    enum Roles {
+        ActionRole = Qt::UserRole + 1,
+        DepthRole,
+    };
+    Q_ENUM(Roles)
+
+    explicit ActionTreeModel(QObject *parent = nullptr);
+    ~ActionTreeModel() override;
+
+    QVariant actions() const;
+    void setActions(const QVariant &actions);
+
+    bool isActive() const;
+    void setActive(bool active);
+
+    bool hasVisibleActions() const;
+
+    int count() const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+Q_SIGNALS:
+    void actionsChanged();
+    void activeChanged();
+    void hasVisibleActionsChanged();
+    void countChanged();
+
+private:
+    struct Row {
+        QObject *action = nullptr;
+        int depth = 0;
+
+        bool operator==(const Row &other) const
+        {
+            return action == other.action && depth == other.depth;
+        }
+    };
+
+    void track(QObject *action);
+    void untrackAll();
+    Q_SLOT void onActionChanged();
+    void onActionDestroyed(QObject *action);
+    bool isVisible(QObject *action) const;
+    void updateHasVisibleActions();
+    void updateRows();
+    void setRows(const QVector<Row> &rows);
+
+    QVariant m_actions;
+    QVector<QPointer<QObject>> m_topLevelActions;
+    QHash<QObject *, bool> m_visibility;
+    QSet<QObject *> m_tracked;
+    QVector<Row> m_rows;
+    bool m_active = false;
+    bool m_hasVisibleActions = false;
+};
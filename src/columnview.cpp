@@ -87,6 +87,11 @@ QtObject {
         anchors.right: column.right
         anchors.bottom: column.bottom
     }
+
+    readonly property Component snapshot: ShaderEffectSource {
+        live: false
+        hideSource: true
+    }
 }
 )"), QUrl(QStringLiteral("columnview.cpp")));
     /* clang-format on */
@@ -101,6 +106,9 @@ QtObject {
     m_rightSeparatorComponent = m_instance->property("rightSeparator").value<QQmlComponent *>();
     Q_ASSERT(m_rightSeparatorComponent);
 
+    m_snapshotComponent = m_instance->property("snapshot").value<QQmlComponent *>();
+    Q_ASSERT(m_snapshotComponent);
+
     m_units = engine->singletonInstance<Kirigami::Units *>(qmlTypeId("org.kde.kirigami", 2, 0, "Units"));
     Q_ASSERT(m_units);
 
@@ -323,7 +331,20 @@ ContentItem::ContentItem(ColumnView *parent)
         }
     });
 
+    connect(m_slideAnim, &QAbstractAnimation::stateChanged, this, [this](QAbstractAnimation::State newState) {
+        if (newState == QAbstractAnimation::Running) {
+            freezeColumns();
+        } else {
+            thawColumns();
+        }
+    });
+
     connect(this, &QQuickItem::xChanged, this, &ContentItem::layoutPinnedItems);
+    connect(this, &QQuickItem::xChanged, this, [this]() {
+        if (m_snapshotLayer) {
+            m_snapshotLayer->setX(x());
+        }
+    });
 }
 
 ContentItem::~ContentItem()
@@ -353,6 +374,88 @@ void ContentItem::animateX(qreal newX)
     m_slideAnim->start();
 }
 
+void ContentItem::freezeColumns()
+{
+    thawColumns();
+
+    if (!m_view->freezeColumnsDuringSlide()) {
+        return;
+    }
+
+    // Every column in the viewport at some point of the slide, in content coordinates
+    const qreal left = -qMax(m_slideAnim->startValue().toReal(), m_slideAnim->endValue().toReal());
+    const qreal right = -qMin(m_slideAnim->startValue().toReal(), m_slideAnim->endValue().toReal()) + m_view->width();
+
+    for (QQuickItem *item : std::as_const(m_items)) {
+        // The current column stays live, it is the one the user interacts with
+        if (item == m_view->currentItem() || !item->isVisible() || item->x() >= right || item->x() + item->width() <= left) {
+            continue;
+        }
+
+        QQuickItem *snapshot = takeSnapshot();
+        if (!snapshot) {
+            return;
+        }
+
+        m_snapshotLayer->setPosition(position());
+        snapshot->setPosition(item->position());
+        snapshot->setSize(item->size());
+        snapshot->setProperty("sourceItem", QVariant::fromValue(item));
+        snapshot->setVisible(true);
+        QMetaObject::invokeMethod(snapshot, "scheduleUpdate");
+    }
+}
+
+void ContentItem::thawColumns()
+{
+    for (int i = 0; i < m_usedSnapshots; ++i) {
+        if (QQuickItem *snapshot = m_snapshots.value(i)) {
+            // Releases the texture and shows the column again
+            snapshot->setProperty("sourceItem", QVariant::fromValue<QQuickItem *>(nullptr));
+            snapshot->setVisible(false);
+        }
+    }
+    m_usedSnapshots = 0;
+}
+
+QQuickItem *ContentItem::takeSnapshot()
+{
+    while (m_usedSnapshots < m_snapshots.count()) {
+        if (QQuickItem *snapshot = m_snapshots[m_usedSnapshots]) {
+            ++m_usedSnapshots;
+            return snapshot;
+        }
+        m_snapshots.removeAt(m_usedSnapshots);
+    }
+
+    QQmlEngine *engine = qmlEngine(m_view);
+    if (!engine) {
+        return nullptr;
+    }
+
+    if (!m_snapshotLayer) {
+        // Parented after being assigned, so ColumnView doesn't take it for a column
+        auto layer = new QQuickItem();
+        m_snapshotLayer = layer;
+        layer->setParent(m_view);
+        layer->setParentItem(m_view);
+        layer->setZ(z() + 1);
+    }
+
+    QQmlComponent *component = QmlComponentsPoolSingleton::instance(engine)->m_snapshotComponent;
+    QQmlContext *context = QQmlEngine::contextForObject(m_view);
+    auto snapshot = qobject_cast<QQuickItem *>(component->beginCreate(context ? context : engine->rootContext()));
+    if (!snapshot) {
+        return nullptr;
+    }
+    snapshot->setParentItem(m_snapshotLayer);
+    component->completeCreate();
+
+    m_snapshots.append(snapshot);
+    ++m_usedSnapshots;
+    return snapshot;
+}
+
 void ContentItem::snapToItem()
 {
     QQuickItem *firstItem = childAt(viewportLeft(), 0);
@@ -1001,6 +1104,25 @@ void ColumnView::setSeparatorVisible(bool visible)
     Q_EMIT separatorVisibleChanged();
 }
 
+bool ColumnView::freezeColumnsDuringSlide() const
+{
+    return m_freezeColumnsDuringSlide;
+}
+
+void ColumnView::setFreezeColumnsDuringSlide(bool freeze)
+{
+    if (freeze == m_freezeColumnsDuringSlide) {
+        return;
+    }
+
+    m_freezeColumnsDuringSlide = freeze;
+    if (!freeze) {
+        m_contentItem->thawColumns();
+    }
+
+    Q_EMIT freezeColumnsDuringSlideChanged();
+}
+
 bool ColumnView::dragging() const
 {
     return m_dragging;
@@ -1130,6 +1252,10 @@ void ColumnView::replaceItem(int pos, QQuickItem *item)
 
     QQuickItem *oldItem = m_contentItem->m_items[pos];
 
+    // The current index moves around while the item is swapped, the view
+    // should stay where it is
+    QPointer<QQuickItem> viewAnchorItem = m_contentItem->m_viewAnchorItem == oldItem ? item : m_contentItem->m_viewAnchorItem.data();
+
     // In order to keep the same current item we need to increase the current index if displaced
     if (m_currentIndex >= pos) {
         setCurrentIndex(m_currentIndex - 1);
@@ -1167,6 +1293,13 @@ void ColumnView::replaceItem(int pos, QQuickItem *item)
         Q_EMIT itemInserted(pos, item);
     }
 
+    if (m_currentIndex >= 0 && m_currentItem != m_contentItem->m_items.value(m_currentIndex)) {
+        m_currentItem = m_contentItem->m_items[m_currentIndex];
+        m_currentItem->forceActiveFocus();
+        Q_EMIT currentItemChanged();
+    }
+    m_contentItem->m_viewAnchorItem = viewAnchorItem;
+
     // Disable animation so replacement happens immediately.
     m_contentItem->m_shouldAnimate = false;
     m_contentItem->layoutItems();
@@ -1600,7 +1733,7 @@ void ColumnView::itemChange(QQuickItem::ItemChange change, const QQuickItem::Ite
 {
     switch (change) {
     case QQuickItem::ItemChildAddedChange:
-        if (m_contentItem && value.item != m_contentItem && !value.item->inherits("QQuickRepeater")) {
+        if (m_contentItem && value.item != m_contentItem && value.item != m_contentItem->m_snapshotLayer && !value.item->inherits("QQuickRepeater")) {
             addItem(value.item);
         }
         break;
@@ -211,6 +211,24 @@ class ColumnView : public QQuickItem
      */
     Q_PROPERTY(bool separatorVisible READ separatorVisible WRITE setSeparatorVisible NOTIFY separatorVisibleChanged)
 
+    /**
+     * True if columns should be replaced by static snapshots while the view
+     * slides to a column.
+     *
+     * Every column crossed by the slide, except the current one, is then
+     * rendered once into a texture when the slide starts, and only the texture
+     * is moved during the animation instead of rendering the whole content of
+     * the column each frame. This makes slides between heavy pages smoother on
+     * weak GPUs, at the cost of the memory for the textures and of content
+     * changes in those columns not showing until the slide is over.
+     *
+     * Default is false.
+     *
+     * @since 5.88
+     * @since org.kde.kirigami 2.19
+     */
+    Q_PROPERTY(bool freezeColumnsDuringSlide READ freezeColumnsDuringSlide WRITE setFreezeColumnsDuringSlide NOTIFY freezeColumnsDuringSlideChanged)
+
     /**
      * The list of all visible column items that are at least partially in the viewport at any given moment
      */
@@ -285,6 +303,9 @@ public:
     bool separatorVisible() const;
     void setSeparatorVisible(bool visible);
 
+    bool freezeColumnsDuringSlide() const;
+    void setFreezeColumnsDuringSlide(bool freeze);
+
     int count() const;
 
     qreal topPadding() const;
@@ -437,6 +458,7 @@ Q_SIGNALS:
     void acceptsMouseChanged();
     void scrollDurationChanged();
     void separatorVisibleChanged();
+    void freezeColumnsDuringSlideChanged();
     void firstVisibleItemChanged();
     void lastVisibleItemChanged();
     void topPaddingChanged();
@@ -472,6 +494,7 @@ private:
     bool m_dragging = false;
     bool m_moving = false;
     bool m_separatorVisible = true;
+    bool m_freezeColumnsDuringSlide = false;
     bool m_complete = false;
     bool m_acceptsMouse = false;
 };
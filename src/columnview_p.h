@@ -27,6 +27,7 @@ public:
 
     QQmlComponent *m_separatorComponent = nullptr;
     QQmlComponent *m_rightSeparatorComponent = nullptr;
+    QQmlComponent *m_snapshotComponent = nullptr;
     Kirigami::Units *m_units = nullptr;
 
 Q_SIGNALS:
@@ -57,6 +58,10 @@ public:
     void animateX(qreal x);
     void snapToItem();
 
+    void freezeColumns();
+    void thawColumns();
+    QQuickItem *takeSnapshot();
+
     inline qreal viewportLeft() const;
     inline qreal viewportRight() const;
 
@@ -77,6 +82,11 @@ private:
     QHash<QQuickItem *, QQuickItem *> m_separators;
     QHash<QQuickItem *, QQuickItem *> m_rightSeparators;
     QHash<QObject *, QObject *> m_models;
+    // Static snapshots of the columns shown in place of them during a slide,
+    // children of m_snapshotLayer. The first m_usedSnapshots are in use.
+    QQuickItem *m_snapshotLayer = nullptr;
+    QList<QPointer<QQuickItem>> m_snapshots;
+    int m_usedSnapshots = 0;
 
     qreal m_leftPinnedSpace = 361;
     qreal m_rightPinnedSpace = 0;
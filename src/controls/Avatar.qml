@@ -7,7 +7,6 @@
 import QtQuick 2.13
 import org.kde.kirigami 2.14 as Kirigami
 import QtQuick.Controls 2.13 as QQC2
-import QtGraphicalEffects 1.0
 import org.kde.kirigami.private 2.14
 
 import "templates/private" as P
@@ -194,7 +193,22 @@ QQC2.Control {
         }
     }
 
-    contentItem: Item {
+    // Image, initials and border are drawn by a single rounded node, so no
+    // layer is needed to clip the image into a circle.
+    contentItem: Kirigami.ShadowedTexture {
+        id: avatarContent
+
+        radius: Math.min(width, height) / 2
+        color: "transparent"
+
+        border {
+            width: avatarRoot.border.width
+            color: avatarRoot.border.color
+        }
+
+        source: __private.showImage && avatarImage.status == Image.Ready ? avatarImage : null
+        fillMode: Kirigami.ShadowedTexture.PreserveAspectCrop
+
         Text {
             id: avatarText
             fontSizeMode: Text.Fit
@@ -229,7 +243,9 @@ QQC2.Control {
         }
         Image {
             id: avatarImage
-            visible: __private.showImage
+            // Only used as texture source, except with software rendering
+            // where ShadowedTexture can't draw textures.
+            visible: __private.showImage && avatarContent.softwareRendering
 
             mipmap: true
             smooth: true
@@ -242,19 +258,7 @@ QQC2.Control {
             anchors.fill: parent
         }
 
-        Rectangle {
-            color: "transparent"
-
-            radius: width / 2
-            anchors.fill: parent
-
-            border {
-                width: avatarRoot.border.width
-                color: avatarRoot.border.color
-            }
-        }
-
-        Rectangle {
+        Item {
             id: secondaryRect
             visible: false
 
@@ -266,7 +270,19 @@ QQC2.Control {
 
             height: Kirigami.Units.iconSizes.small + Kirigami.Units.smallSpacing*2
 
-            color: Qt.rgba(0, 0, 0, 0.6)
+            // A rectangular clip is done with a scissor, this cuts the bottom
+            // of a circle without an offscreen pass.
+            clip: true
+
+            Rectangle {
+                x: 0
+                y: parent.height - height
+                width: avatarContent.width
+                height: avatarContent.height
+                radius: avatarContent.radius
+
+                color: Qt.rgba(0, 0, 0, 0.6)
+            }
 
             Kirigami.Icon {
                 Kirigami.Theme.textColor: "white"
@@ -279,16 +295,5 @@ QQC2.Control {
                 y: Math.round((parent.height/2)-(this.height/2))
             }
         }
-
-        layer.enabled: true
-        layer.effect: OpacityMask {
-            maskSource: Rectangle {
-                height: avatarRoot.height
-                width: avatarRoot.width
-                radius: height / 2
-                color: "black"
-                visible: false
-            }
-        }
     }
 }
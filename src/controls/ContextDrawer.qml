@@ -7,6 +7,7 @@
 import QtQuick 2.1
 import QtQuick.Layouts 1.2
 import org.kde.kirigami 2.4
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
 
 import "private"
 import "templates/private"
@@ -85,7 +86,7 @@ OverlayDrawer {
     }
 
     // Disable for empty menus or when we have a global toolbar
-    enabled: menu.count > 0 &&
+    enabled: actionsModel.hasVisibleActions &&
             (typeof applicationWindow() === "undefined" || !applicationWindow().pageStack.globalToolBar ||
             (applicationWindow().pageStack.lastVisibleItem && applicationWindow().pageStack.lastVisibleItem.globalToolBarStyle !== ApplicationHeaderStyle.ToolBar) ||
             (applicationWindow().pageStack.layers && applicationWindow().pageStack.layers.depth > 1 && applicationWindow().pageStack.layers.currentItem && applicationWindow().pageStack.layers.currentItem.globalToolBarStyle !== ApplicationHeaderStyle.ToolBar))
@@ -125,32 +126,11 @@ OverlayDrawer {
         ListView {
             id: menu
             interactive: contentHeight > height
-            model: {
-                if (typeof root.actions == "undefined") {
-                    return null;
-                }
-                if (root.actions.length === 0) {
-                    return null;
-                } else {
-
-                    // Check if at least one action is visible
-                    var somethingVisible = false;
-                    for (var i=0; i<root.actions.length; i++) {
-                        if (root.actions[i].visible) {
-                            somethingVisible = true;
-                            break;
-                        }
-                    }
-
-                    if (!somethingVisible) {
-                        return null;
-                    }
-
-                    return root.actions[0].text !== undefined &&
-                        root.actions[0].trigger !== undefined ?
-                            root.actions :
-                            root.actions[0];
-                }
+            model: KirigamiPrivate.ActionTreeModel {
+                id: actionsModel
+                actions: root.actions
+                // Rows are only built while the drawer is at least partially shown
+                active: root.drawerOpen || root.position > 0
             }
             topMargin: root.handle.y > 0 ? menu.height - menu.contentHeight : 0
             header: Item {
@@ -168,19 +148,11 @@ OverlayDrawer {
                     text: root.title
                 }
             }
-            delegate: Column {
-                width: parent.width
-                ContextDrawerActionItem {
-                    width: parent.width
-                }
-                Repeater {
-                    model: modelData.hasOwnProperty("expandible") && modelData.expandible ? modelData.children : null
-                    delegate: ContextDrawerActionItem {
-                        width: parent.width
-                        leftPadding: Units.largeSpacing * 2
-                        opacity: !root.collapsed
-                    }
-                }
+            delegate: ContextDrawerActionItem {
+                width: menu.width
+                modelAction: model.action
+                leftPadding: model.depth > 0 ? Units.largeSpacing * 2 : padding * 2
+                opacity: model.depth > 0 ? !root.collapsed : 1
             }
         }
     }
@@ -8,6 +8,7 @@
 import QtQuick 2.14
 import QtQuick.Controls 2.4 as QQC2
 import org.kde.kirigami 2.13 as Kirigami
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
 
 /**
  * An element that implements a shared element transition, otherwise known as a "hero animation"
@@ -63,40 +64,40 @@ Item {
         *
         * The progress of the animation, where 0 is the start and 1 is the end.
         */
-        readonly property real sourceProgress: sourceEffect.progress
+        readonly property real sourceProgress: __private.progress
         /**
         * destinationProgress: real
         *
         * The progress of the animation, where 1 is the start and 0 is the end.
         */
-        readonly property real destinationProgress: destinationEffect.progress
+        readonly property real destinationProgress: 1 - __private.progress
 
         /**
         * sourceHeight: real
         *
         * The height of the source item.
         */
-        readonly property real sourceHeight: sourceEffect.height
+        readonly property real sourceHeight: __private.source ? __private.source.height : 0
         /**
         * sourceWidth: real
         *
         * The width of the source item.
         */
-        readonly property real sourceWidth: sourceEffect.width
+        readonly property real sourceWidth: __private.source ? __private.source.width : 0
 
         /**
         * destinationWidth: real
         *
         * The width of the destination item.
         */
-        readonly property real destinationWidth: destinationEffect.width
+        readonly property real destinationWidth: __private.destination ? __private.destination.width : 0
 
         /**
         * destinationHeight: real
         *
         * The height of the destination item.
         */
-        readonly property real destinationHeight: destinationEffect.height
+        readonly property real destinationHeight: __private.destination ? __private.destination.height : 0
 
         /**
         * item: Item
@@ -105,6 +106,7 @@ Item {
         * sourceProgress and destinationProgress to change as the animation progresses.
         */
         property Item item: Rectangle {
+            id: defaultMask
             visible: false
             color: "white"
 
@@ -112,187 +114,115 @@ Item {
             width: (mask.sourceWidth * mask.sourceProgress) + (mask.destinationWidth * mask.destinationProgress)
             height: (mask.sourceHeight * mask.sourceProgress) + (mask.destinationHeight * mask.destinationProgress)
 
-            layer.enabled: true
+            // The default mask is drawn by the transition itself, this is
+            // only rendered when it is used as a custom mask elsewhere.
+            layer.enabled: root.mask.item !== defaultMask
             layer.smooth: true
         }
     }
 
-    property alias duration: sourceAni.duration
+    property alias duration: transition.duration
     readonly property QtObject easing: QtObject {
-        property alias amplitude: sourceAni.easing.amplitude
-        property alias bezierCurve: sourceAni.easing.bezierCurve
-        property alias overshoot: sourceAni.easing.overshoot
-        property alias period: sourceAni.easing.period
-        property alias type: sourceAni.easing.type
+        property alias amplitude: transition.easing.amplitude
+        property alias bezierCurve: transition.easing.bezierCurve
+        property alias overshoot: transition.easing.overshoot
+        property alias period: transition.easing.period
+        property alias type: transition.easing.type
     }
 
     function open() {
-        if (source != null && destination != null && !heroAnimation.running) {
-            heroAnimation.source = source
-            heroAnimation.destination = destination
-            heroAnimation.restart()
+        if (source != null && destination != null && !transition.running) {
+            __private.start(source, destination)
         }
     }
     function close() {
-        if (source != null && destination != null && !heroAnimation.running) {
+        if (source != null && destination != null && !transition.running) {
             // doing a switcheroo simplifies the code
-            heroAnimation.source = destination
-            heroAnimation.destination = source
-            heroAnimation.restart()
+            __private.start(destination, source)
         }
     }
 
-    SequentialAnimation {
-        id: heroAnimation
+    QtObject {
+        id: __private
 
-        property Item source: Item {}
-        property Item destination: Item {}
+        property Item source
+        property Item destination
+        property real progress: 0
 
-        ScriptAction {
-            script: {
-                heroAnimation.source.layer.enabled = true
-                heroAnimation.source.layer.smooth = true
-                heroAnimation.destination.layer.enabled = true
-                heroAnimation.destination.layer.smooth = true
-                sourceEffect.visible = true
-                destinationEffect.visible = true
-                sourceEffect.source = null
-                sourceEffect.source = heroAnimation.source
-                destinationEffect.source = null
-                destinationEffect.source = heroAnimation.destination
-                heroAnimation.source.opacity = 0
-                heroAnimation.destination.opacity = 0
-                sourceEffect.parent.visible = true
-            }
-        }
-        ParallelAnimation {
-            NumberAnimation {
-                id: sourceAni
+        function start(from, to) {
+            source = from
+            destination = to
 
-                target: sourceEffect
-                property: "progress"
-                from: 0
-                to: 1
-                duration: Kirigami.Units.longDuration
-                easing.type: Easing.InOutQuad
-            }
-            NumberAnimation {
-                target: destinationEffect
-                property: "progress"
-                from: 1
-                to: 0
-                duration: root.duration
-                easing.amplitude: root.easing.amplitude
-                easing.bezierCurve: root.easing.bezierCurve
-                easing.overshoot: root.easing.overshoot
-                easing.period: root.easing.period
-                easing.type: root.easing.type
-            }
-        }
-        ScriptAction {
-            script: {
-                sourceEffect.visible = false
-                destinationEffect.visible = false
-                heroAnimation.source.layer.enabled = false
-                heroAnimation.source.layer.smooth = false
-                heroAnimation.destination.layer.enabled = false
-                heroAnimation.destination.layer.smooth = false
-                heroAnimation.destination.opacity = 1
-                if (root.restore) {
-                    heroAnimation.source.opacity = 1
-                }
-                sourceEffect.parent.visible = false
-            }
-        }
+            const overlay = from.QQC2.Overlay.overlay
+            transition.parent = overlay
+            transition.sourceRect = from.mapToItem(overlay, 0, 0, from.width, from.height)
+            transition.destinationRect = to.mapToItem(overlay, 0, 0, to.width, to.height)
 
-    }
+            // A previous transition without restore may have hidden it
+            to.opacity = 1
 
-    QtObject {
-        id: __privateShaderSources
-        readonly property string vertexShader: `
-uniform highp mat4 qt_Matrix;
-attribute highp vec4 qt_Vertex;
-attribute highp vec2 qt_MultiTexCoord0;
-varying highp vec2 qt_TexCoord0;
-uniform highp float startX;
-uniform highp float startY;
-uniform highp float targetX;
-uniform highp float targetY;
-uniform highp float scaleWidth;
-uniform highp float scaleHeight;
-uniform highp float progress;
+            // Take a single snapshot of both ends, this also hides them
+            // while the transition runs.
+            sourceSnapshot.sourceItem = from
+            sourceSnapshot.scheduleUpdate()
+            destinationSnapshot.sourceItem = to
+            destinationSnapshot.scheduleUpdate()
 
-highp mat4 morph = mat4(1.0 + (scaleWidth - 1.0) * progress, 0.0, 0.0, startX*(1.0-progress) + targetX*progress,
-                        0.0, 1.0 + (scaleHeight - 1.0) * progress, 0.0, startY*(1.0-progress) + targetY*progress,
-                        0.0, 0.0, 1.0, 0.0,
-                        0.0, 0.0, 0.0, 1.0);
+            // The default mask is drawn by the transition itself, the mask
+            // properties are still animated for anything bound to them.
+            transition.mask = root.mask.item !== defaultMask ? root.mask.item : null
+            maskAnimation.restart()
 
-void main() {
-    qt_TexCoord0 = qt_MultiTexCoord0;
-    gl_Position = qt_Matrix * qt_Vertex * morph;
-}
-        `
+            transition.start()
+        }
     }
 
-    ShaderEffect {
-        id: sourceEffect
-        x: 0
-        y: 0
-        parent: heroAnimation.source.QQC2.Overlay.overlay
-        width: heroAnimation.source.width
-        height: heroAnimation.source.height
-        visible: false
-        property variant source: heroAnimation.source
-        property real progress: 0
-        property real startX: heroAnimation.source.Kirigami.ScenePosition.x / (applicationWindow().width / 2)
-        property real startY: -heroAnimation.source.Kirigami.ScenePosition.y / (applicationWindow().height / 2)
+    NumberAnimation {
+        id: maskAnimation
+        target: __private
+        property: "progress"
+        from: 0
+        to: 1
+        duration: transition.duration
+        easing: transition.easing
+    }
 
-        property real targetX: scaleWidth - 1 + (heroAnimation.destination.Kirigami.ScenePosition.x * 2) / applicationWindow().width
-        property real targetY: 1-scaleHeight - (heroAnimation.destination.Kirigami.ScenePosition.y * 2) / applicationWindow().height
-        property real scaleWidth: heroAnimation.destination.width/heroAnimation.source.width
-        property real scaleHeight: heroAnimation.destination.height/heroAnimation.source.height
-        vertexShader: __privateShaderSources.vertexShader
-        fragmentShader: `
-varying highp vec2 qt_TexCoord0;
-uniform sampler2D source;
-uniform lowp float qt_Opacity;
-uniform lowp float progress;
-void main() {
-    gl_FragColor = texture2D(source, qt_TexCoord0) * qt_Opacity * (1.0 - progress);
-}
-        `
+    ShaderEffectSource {
+        id: sourceSnapshot
+        parent: transition
+        visible: false
+        live: false
+        hideSource: sourceItem !== null
     }
 
-    ShaderEffect {
-        id: destinationEffect
-        x: 0
-        y: 0
-        parent: heroAnimation.destination.QQC2.Overlay.overlay
-        width: heroAnimation.destination.width
-        height: heroAnimation.destination.height
+    ShaderEffectSource {
+        id: destinationSnapshot
+        parent: transition
         visible: false
-        property variant source: heroAnimation.destination
-        property real progress: sourceEffect.progress
-        property real startX: heroAnimation.destination.Kirigami.ScenePosition.x / (applicationWindow().width / 2)
-        property real startY: -heroAnimation.destination.Kirigami.ScenePosition.y / (applicationWindow().height / 2)
+        live: false
+        hideSource: sourceItem !== null
+    }
 
-        property real targetX: scaleWidth - 1 + (heroAnimation.source.Kirigami.ScenePosition.x * 2) / applicationWindow().width
-        property real targetY: 1-scaleHeight - (heroAnimation.source.Kirigami.ScenePosition.y * 2) / applicationWindow().height
-        property real scaleWidth: heroAnimation.source.width/heroAnimation.destination.width
-        property real scaleHeight: heroAnimation.source.height/heroAnimation.destination.height
+    KirigamiPrivate.HeroTransition {
+        id: transition
+        objectName: "heroTransition"
 
-        property variant maskSource: root.mask.item
+        width: parent ? parent.width : 0
+        height: parent ? parent.height : 0
 
-        vertexShader: __privateShaderSources.vertexShader
-        fragmentShader: `
-varying highp vec2 qt_TexCoord0;
-uniform sampler2D source;
-uniform sampler2D maskSource;
-uniform lowp float qt_Opacity;
-uniform lowp float progress;
-void main() {
-    gl_FragColor = texture2D(source, qt_TexCoord0) * texture2D(maskSource, qt_TexCoord0).a * qt_Opacity *  (1.0 - progress);
-}
-        `
+        source: sourceSnapshot
+        destination: destinationSnapshot
+
+        duration: Kirigami.Units.longDuration
+        easing.type: Easing.InOutQuad
+
+        onFinished: {
+            maskAnimation.complete()
+            sourceSnapshot.sourceItem = null
+            destinationSnapshot.sourceItem = null
+            if (!root.restore) {
+                __private.source.opacity = 0
+            }
+        }
     }
 }
@@ -6,7 +6,6 @@
 
 import QtQuick 2.5
 import QtQuick.Templates 2.0 as T2
-import QtGraphicalEffects 1.0
 import org.kde.kirigami 2.4 as Kirigami
 import "private"
 
@@ -89,14 +88,10 @@ Kirigami.AbstractItemViewHeader {
             opacity: 1
             elide: Text.ElideRight
 
-            layer.enabled: root.backgroundImage.hasImage
-            layer.effect: DropShadow {
-                horizontalOffset: 0
-                verticalOffset: 2
-                radius: Kirigami.Units.smallSpacing*2
-                samples: 32
-                color: Qt.rgba(0, 0, 0, 0.7)
-            }
+            // A raised text style is drawn together with the glyphs, unlike
+            // a blurred shadow it needs no layer.
+            style: root.backgroundImage.hasImage ? Text.Raised : Text.Normal
+            styleColor: Qt.rgba(0, 0, 0, 0.7)
         }
     }
 }
@@ -9,7 +9,8 @@ import QtQml 2.15
 import QtQuick.Templates 2.15 as T
 import QtQuick.Layouts 1.15
 import org.kde.kirigami 2.19 as Kirigami
-import QtGraphicalEffects 1.12
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
+import "private" as P
 
 /**
  * Page navigation tab-bar, used as an alternative to sidebars for 3-5 elements.
@@ -165,39 +166,18 @@ T.ToolBar {
      * If the index set is out of bounds, or the triggered signal did not change any checked property of an action, the index
      * will remain the same.
      */
-    property int currentIndex: tabGroup.checkedButton && tabGroup.buttons.length > 0 ? tabGroup.checkedButton.tabIndex : -1
+    property alias currentIndex: tabLayout.currentIndex
 
     /**
      * This property holds the number of tab buttons.
      */
-    readonly property int count: tabGroup.buttons.length
+    readonly property alias count: tabLayout.count
 
     /**
      * This property holds the ButtonGroup used to manage the tabs.
      */
     readonly property T.ButtonGroup tabGroup: tabGroup
 
-    onCurrentIndexChanged: {
-        if (currentIndex === -1) {
-            if (tabGroup.checkState !== Qt.Unchecked) {
-                tabGroup.checkState = Qt.Unchecked;
-            }
-            return;
-        }
-        if (tabGroup.checkedButton.tabIndex !== currentIndex) {
-            const buttonForCurrentIndex = tabGroup.buttons[currentIndex]
-            if (buttonForCurrentIndex.action) {
-                // trigger also toggles and causes clicked() to be emitted
-                buttonForCurrentIndex.action.trigger();
-            } else {
-                // toggle() does not trigger the action,
-                // so don't use it if you want to use an action.
-                // It also doesn't cause clicked() to be emitted.
-                buttonForCurrentIndex.toggle();
-            }
-        }
-    }
-
     // Using Math.round() on horizontalPadding can cause the contentItem to jitter left and right when resizing the window.
     horizontalPadding: Math.floor(Math.max(0, width - root.maximumContentWidth) / 2)
     contentWidth: Math.ceil(Math.min(root.availableWidth, root.maximumContentWidth))
@@ -209,53 +189,36 @@ T.ToolBar {
     background: Rectangle { // color & shadow
         implicitHeight: Kirigami.Units.gridUnit * 3 + Kirigami.Units.smallSpacing * 2
         color: root.backgroundColor
-        RectangularGlow {
-            anchors.fill: parent
-            z: -1
+        P.BoxShadow {
+            source: parent
             visible: root.shadow
-            glowRadius: 5
-            spread: 0.3
-            color: Qt.rgba(0.0, 0.0, 0.0, 0.15)
+            shadow {
+                size: 10
+                yOffset: 0
+                color: Qt.rgba(0.0, 0.0, 0.0, 0.15)
+            }
         }
     }
 
-    // Using Row because setting just width is more convenient than having to set Layout.minimumWidth and Layout.maximumWidth
-    contentItem: Row {
-        id: rowLayout
+    // Creates a tab for each action, reusing the tabs of earlier actions, and
+    // gives every visible tab the same width.
+    contentItem: KirigamiPrivate.NavigationTabLayout {
+        id: tabLayout
         spacing: root.spacing
-    }
+        actions: root.actions
 
-    // Used to manage which tab is checked and change the currentIndex
-    T.ButtonGroup {
-        id: tabGroup
-        exclusive: true
-        buttons: root.contentItem.children
-        
-        onCheckedButtonChanged: {
-            if (root.currentIndex !== checkedButton.tabIndex) {
-                root.currentIndex = checkedButton.tabIndex;
-            }
-        }
-    }
-
-    // Using an Instantiator instead of a Repeater allows us to use parent.visibleChildren.length without including a Repeater in that count.
-    Instantiator {
-        id: instantiator
-        model: root.actions
         delegate: NavigationTabButton {
-            id: delegate
-            parent: root.contentItem
-            action: modelData
-            visible: modelData.visible
-            T.ButtonGroup.group: tabGroup
-            // Workaround setting the action when checkable is not explicitly set making tabs uncheckable
-            onActionChanged: action.checkable = true
-            
+            visible: action ? action.visible : false
+            T.ButtonGroup.group: root.tabGroup
+
             foregroundColor: root.foregroundColor
             highlightForegroundColor: root.highlightForegroundColor
             highlightBarColor: root.highlightBarColor
         }
     }
-}
-
 
+    T.ButtonGroup {
+        id: tabGroup
+        exclusive: true
+    }
+}
@@ -17,6 +17,10 @@ T.TabButton {
      * The index of this tab within the tab bar.
      */
     readonly property int tabIndex: {
+        if (parent && parent.tabs !== undefined) {
+            // Laid out by NavigationTabBar, which keeps the list of tabs
+            return parent.tabs.indexOf(control)
+        }
         let tabIdx = 0
         for (let i = 0; i < parent.children.length; ++i) {
             if (parent.children[i] === this) return tabIdx
@@ -38,6 +42,10 @@ T.TabButton {
                              implicitContentHeight + topPadding + bottomPadding)
 
     width: {
+        if (parent && parent.tabWidth !== undefined) {
+            // Laid out by NavigationTabBar, which divides its width between the visible tabs
+            return Math.max(implicitWidth, parent.tabWidth)
+        }
         // Counting buttons because Repeaters can be counted among visibleChildren
         let visibleButtonCount = 0
         for (let i = 0; i < parent.visibleChildren.length; ++i) {
@@ -167,6 +167,18 @@ T.Control {
     // TODO KF6: globaldrawer should use action al so used by this sidebar instead of reparenting globaldrawer contents?
     property OverlayDrawer leftSidebar
 
+    /**
+     * How many containers used by pushDialogLayer are kept around once closed,
+     * so that opening a dialog again only costs the creation of its page.
+     * On desktop this amount of hidden windows is also created in advance.
+     * default: 0, containers are destroyed when closed
+     *
+     * @since 5.88
+     */
+    property int dialogPoolSize: 0
+
+    onDialogPoolSizeChanged: dialogLogic.fillPool()
+
     onLeftSidebarChanged: {
         if (leftSidebar && !leftSidebar.modal) {
             modalConnection.onModalChanged();
@@ -250,77 +262,19 @@ T.Control {
         if (Settings.isMobile) {
             if (QQC2.ApplicationWindow.window.width > Units.gridUnit * 40) {
                 // open as a QQC2.Dialog
-                const dialog = Qt.createQmlObject('
-                    import QtQuick 2.15;
-                    import QtQuick.Controls 2.15;
-                    import QtQuick.Layouts 1.15;
-                    import org.kde.kirigami 2.15 as Kirigami;
-                    Dialog {
-                        id: dialog
-                        modal: true;
-                        leftPadding: 0; rightPadding: 0; topPadding: 0; bottomPadding: 0;
-                        clip: true
-                        header: Kirigami.AbstractApplicationHeader {
-                            pageRow: null
-                            page: null
-                            minimumHeight: Units.gridUnit * 1.6
-                            maximumHeight: Units.gridUnit * 1.6
-                            preferredHeight: Units.gridUnit * 1.6
-
-                            Keys.onEscapePressed: {
-                                if (dialog.opened) {
-                                    dialog.close();
-                                } else {
-                                    event.accepted = false;
-                                }
-                            }
-
-                            contentItem: RowLayout {
-                                width: parent.width
-                                Kirigami.Heading {
-                                    Layout.leftMargin: Kirigami.Units.largeSpacing
-                                    text: dialog.title
-                                    elide: Text.ElideRight
-                                }
-                                Item {
-                                    Layout.fillWidth: true;
-                                }
-                                Kirigami.Icon {
-                                    id: closeIcon
-                                    Layout.alignment: Qt.AlignVCenter
-                                    Layout.rightMargin: Kirigami.Units.largeSpacing
-                                    Layout.preferredHeight: Kirigami.Units.iconSizes.smallMedium
-                                    Layout.preferredWidth: Kirigami.Units.iconSizes.smallMedium
-                                    source: closeMouseArea.containsMouse ? "window-close" : "window-close-symbolic"
-                                    active: closeMouseArea.containsMouse
-                                    MouseArea {
-                                        id: closeMouseArea
-                                        hoverEnabled: true
-                                        anchors.fill: parent
-                                        onClicked: dialog.close();
-                                    }
-                                }
-                            }
-                        }
-                        contentItem: Control { topPadding: 0; leftPadding: 0; rightPadding: 0; bottomPadding: 0; }
-                    }', QQC2.ApplicationWindow.overlay);
-                dialog.width = Qt.binding(() => QQC2.ApplicationWindow.window.width - Units.gridUnit * 5);
-                dialog.height = Qt.binding(() => QQC2.ApplicationWindow.window.height - Units.gridUnit * 5);
-                dialog.x = Units.gridUnit * 2.5;
-                dialog.y = Units.gridUnit * 2.5;
-
-                if (typeof page === "string") {
-                    // url => load component and then load item from component
-                    const component = Qt.createComponent(Qt.resolvedUrl(page));
-                    item = component.createObject(dialog.contentItem, properties);
-                    dialog.contentItem.contentItem = item
-                } else if (page instanceof Component) {
-                    item = page.createObject(dialog.contentItem, properties);
-                    dialog.contentItem.contentItem = item
+                const dialog = dialogLogic.takeDialog();
+
+                const pageComp = pagesLogic.getPageComponent(page);
+                if (pageComp) {
+                    // url or component => load item from component
+                    item = pageComp.createObject(dialog.contentItem, properties);
+                    dialog.ownsPage = true;
+                    dialog.contentItem.contentItem = item;
                 } else if (page instanceof Item) {
                     item = page;
                     page.parent = dialog.contentItem;
                 }
+                dialog.page = item;
                 dialog.title = Qt.binding(() => item.title);
 
                 // Pushing a PageRow is supported but without PageRow toolbar
@@ -362,14 +316,14 @@ T.Control {
             if (!windowProperties.flags) {
                 windowProperties.flags = Qt.Dialog | Qt.WindowCloseButtonHint;
             }
-            const windowComponent = Qt.createComponent(Qt.resolvedUrl("./ApplicationWindow.qml"));
-            const window = windowComponent.createObject(root, windowProperties);
+            const window = dialogLogic.takeWindow(windowProperties);
             item = window.pageStack.push(page, properties);
             Object.defineProperty(item, 'closeDialog', {
                 value: function() {
                     window.close();
                 }
             });
+            window.visible = true;
         }
         return item;
     }
@@ -607,6 +561,55 @@ T.Control {
         return columnView.contentChildren[idx];
     }
 
+    /**
+     * Restores a stack of pages, for instance one saved when the application
+     * was last closed, replacing the current content of the row.
+     *
+     * Only the current page and the ones next to it are created right away.
+     * The others are represented by empty placeholder columns of the same
+     * width, and are created when they are navigated to or dragged into view.
+     * Until then, get() and items return the placeholder, which only has the
+     * title of the page.
+     *
+     * @param pages The pages to restore, from first to last. Each entry is a
+     * page as accepted by push(), or an object with the following properties:
+     * * ``page``: the page, as a component or a url.
+     * * ``properties``: optional properties to initialize the page with.
+     * * ``title``: optional, the title shown for the page until it is created,
+     *   the title in ``properties`` if not given.
+     * * ``fillWidth``: optional, whether the column of the page fills the
+     *   available width, see ColumnView::fillWidth.
+     * * ``implicitWidth``: optional, the width of the column when columns are
+     *   sized dynamically.
+     * @param currentIndex The index of the page to make current, the last page
+     * if not given.
+     * @return The current page
+     * @since 5.88
+     * @since org.kde.kirigami 2.19
+     */
+    function restore(pages, currentIndex) {
+        clear();
+        if (!pages || pages.length === 0) {
+            return null;
+        }
+
+        for (var i = 0; i < pages.length; ++i) {
+            var descriptor = pages[i];
+            if (descriptor.createObject !== undefined || typeof descriptor == "string") {
+                descriptor = {page: descriptor};
+            }
+            columnView.addItem(pagesLogic.placeholderComponent.createObject(null, {descriptor: descriptor}));
+        }
+
+        if (currentIndex === undefined || currentIndex < 0 || currentIndex >= pages.length) {
+            currentIndex = pages.length - 1;
+        }
+        root.currentIndex = currentIndex;
+        pagesLogic.materializeNearViewport();
+
+        return root.currentItem;
+    }
+
     /**
      * Go back to the previous index and scroll to the left to show one more column.
      */
@@ -827,6 +830,155 @@ T.Control {
             columnView.insertItem(position, page);
             return page;
         }
+
+        // Stands in for a restored page that has not been created yet
+        readonly property Component placeholderComponent: Component {
+            Item {
+                readonly property bool __isPagePlaceholder: true
+                property var descriptor
+                readonly property string title: descriptor.title || (descriptor.properties && descriptor.properties.title) || ""
+                implicitWidth: descriptor.implicitWidth || 0
+                ColumnView.fillWidth: descriptor.fillWidth || false
+            }
+        }
+
+        function materialize(placeholder) {
+            const page = initPage(placeholder.descriptor.page, placeholder.descriptor.properties);
+            columnView.replaceItem(placeholder.ColumnView.index, page);
+            return page;
+        }
+
+        // Creates the pages of placeholders around the current one, as many
+        // columns on each side as fit in the view. This doesn't use the
+        // visible items, as those include every column passed by while
+        // scrolling to the current one.
+        function materializeNearViewport() {
+            if (columnView.count === 0) {
+                return;
+            }
+            const columns = columnView.columnResizeMode === ColumnView.SingleColumn
+                ? 1 : Math.max(1, Math.ceil(columnView.width / Math.max(1, columnView.columnWidth)));
+            const current = Math.max(0, columnView.currentIndex);
+            const first = Math.max(0, current - columns);
+            const last = Math.min(columnView.count - 1, current + columns);
+
+            for (let i = first; i <= last; ++i) {
+                const item = columnView.contentChildren[i];
+                if (item && item.__isPagePlaceholder) {
+                    materialize(item);
+                }
+            }
+        }
+
+        // Creates the pages of placeholders the user dragged into view
+        function materializeVisible() {
+            const items = columnView.visibleItems;
+            for (let i = 0; i < items.length; ++i) {
+                if (items[i].__isPagePlaceholder) {
+                    materialize(items[i]);
+                }
+            }
+        }
+    }
+
+    QtObject {
+        id: dialogLogic
+        // Both components are compiled only once and then reused for every pushDialogLayer
+        property Component dialogComponent
+        property Component windowComponent
+        readonly property var dialogPool: new Array()
+        readonly property var windowPool: new Array()
+
+        function createDialog() {
+            if (!dialogComponent) {
+                dialogComponent = Qt.createComponent(Qt.resolvedUrl("private/PageRowDialog.qml"));
+            }
+            const dialog = dialogComponent.createObject(QQC2.ApplicationWindow.overlay);
+            if (dialogComponent.status === Component.Error) {
+                throw new Error("Error while loading dialog: " + dialogComponent.errorString());
+            }
+            dialog.closed.connect(() => {
+                dialog.releasePage();
+                if (dialogPool.length < root.dialogPoolSize) {
+                    dialogPool.push(dialog);
+                } else {
+                    dialog.destroy();
+                }
+            });
+            return dialog;
+        }
+
+        function createWindow() {
+            if (!windowComponent) {
+                windowComponent = Qt.createComponent(Qt.resolvedUrl("./ApplicationWindow.qml"));
+            }
+            const window = windowComponent.createObject(root, {visible: false});
+            if (windowComponent.status === Component.Error) {
+                throw new Error("Error while loading dialog window: " + windowComponent.errorString());
+            }
+            // Values the window had before the properties of a pushDialogLayer call
+            // were applied, restored once it is hidden again
+            Object.defineProperty(window, '__defaultProperties', {
+                value: {}
+            });
+            window.visibleChanged.connect(() => {
+                if (window.visible) {
+                    return;
+                }
+                window.pageStack.clear();
+                const defaults = window.__defaultProperties;
+                for (let prop in defaults) {
+                    window[prop] = defaults[prop];
+                    delete defaults[prop];
+                }
+                if (windowPool.length < root.dialogPoolSize) {
+                    windowPool.push(window);
+                } else {
+                    window.destroy();
+                }
+            });
+            return window;
+        }
+
+        function takeDialog() {
+            const dialog = dialogPool.length > 0 ? dialogPool.pop() : createDialog();
+            // Recycled dialogs may have been changed by the page they showed
+            dialog.width = Qt.binding(() => QQC2.ApplicationWindow.window.width - Units.gridUnit * 5);
+            dialog.height = Qt.binding(() => QQC2.ApplicationWindow.window.height - Units.gridUnit * 5);
+            dialog.x = Units.gridUnit * 2.5;
+            dialog.y = Units.gridUnit * 2.5;
+            dialog.title = "";
+            return dialog;
+        }
+
+        function takeWindow(windowProperties) {
+            const window = windowPool.length > 0 ? windowPool.pop() : createWindow();
+            const defaults = window.__defaultProperties;
+            for (let prop in windowProperties) {
+                if (windowProperties.hasOwnProperty(prop)) {
+                    if (!defaults.hasOwnProperty(prop)) {
+                        defaults[prop] = window[prop];
+                    }
+                    window[prop] = windowProperties[prop];
+                }
+            }
+            return window;
+        }
+
+        // Pre-create the hidden windows outside of pushDialogLayer, dialogs are only pooled once closed
+        function fillPool() {
+            if (Settings.isMobile) {
+                return;
+            }
+            while (windowPool.length > root.dialogPoolSize) {
+                windowPool.pop().destroy();
+            }
+            Qt.callLater(() => {
+                while (windowPool.length < root.dialogPoolSize) {
+                    windowPool.push(createWindow());
+                }
+            });
+        }
     }
 
     RowLayout {
@@ -856,8 +1008,26 @@ T.Control {
             columnResizeMode: root.wideMode ? ColumnView.FixedColumns : ColumnView.SingleColumn
             columnWidth: root.defaultColumnWidth
 
-            onItemInserted: root.pageInserted(position, item);
-            onItemRemoved: root.pageRemoved(item);
+            onItemInserted: {
+                if (!item.__isPagePlaceholder) {
+                    root.pageInserted(position, item);
+                }
+            }
+            onItemRemoved: {
+                if (!item.__isPagePlaceholder) {
+                    root.pageRemoved(item);
+                }
+            }
+            // Replacing placeholders changes the current index, so don't do it
+            // from within the change notification
+            onCurrentIndexChanged: Qt.callLater(pagesLogic.materializeNearViewport)
+            onColumnResizeModeChanged: Qt.callLater(pagesLogic.materializeNearViewport)
+            onWidthChanged: Qt.callLater(pagesLogic.materializeNearViewport)
+            onDraggingChanged: {
+                if (!dragging) {
+                    Qt.callLater(pagesLogic.materializeVisible);
+                }
+            }
         }
     }
 
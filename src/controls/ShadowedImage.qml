@@ -30,5 +30,6 @@ Item {
         anchors.fill: parent
 
         source: image.status == Image.Ready ? image : null
+        fillMode: image.fillMode == Image.PreserveAspectCrop ? ShadowedTexture.PreserveAspectCrop : ShadowedTexture.Stretch
     }
 }
@@ -7,7 +7,6 @@
 import QtQuick 2.1
 import QtQuick.Layouts 1.2
 import QtQuick.Controls 2.0 as Controls
-import QtGraphicalEffects 1.0
 import org.kde.kirigami 2.16
 
 import "../templates/private"
@@ -256,6 +255,22 @@ Item {
                     fill: parent
                 }
 
+                BoxShadow {
+                    source: buttonGraphics
+                    z: -2
+                    shadow.color: Qt.rgba(0, 0, 0, mouseArea.pressed ? 0.6 : 0.4)
+                }
+                BoxShadow {
+                    source: leftButtonGraphics
+                    z: -2
+                    shadow.color: Qt.rgba(0, 0, 0, mouseArea.pressed ? 0.6 : 0.4)
+                }
+                BoxShadow {
+                    source: rightButtonGraphics
+                    z: -2
+                    shadow.color: Qt.rgba(0, 0, 0, mouseArea.pressed ? 0.6 : 0.4)
+                }
+
                 Rectangle {
                     id: buttonGraphics
                     radius: width/2
@@ -393,15 +408,6 @@ Item {
                 }
             }
 
-            DropShadow {
-                anchors.fill: background
-                horizontalOffset: 0
-                verticalOffset: 1
-                radius: Units.gridUnit /2
-                samples: 16
-                color: Qt.rgba(0, 0, 0, mouseArea.pressed ? 0.6 : 0.4)
-                source: background
-            }
         }
     }
 
@@ -426,14 +432,9 @@ Item {
         height: width
 
 
-        DropShadow {
-            anchors.fill: handleGraphics
-            horizontalOffset: 0
-            verticalOffset: 1
-            radius: Units.gridUnit /2
-            samples: 16
-            color: Qt.rgba(0, 0, 0, fakeContextMenuButton.pressed ? 0.6 : 0.4)
+        BoxShadow {
             source: handleGraphics
+            shadow.color: Qt.rgba(0, 0, 0, fakeContextMenuButton.pressed ? 0.6 : 0.4)
         }
         Rectangle {
             id: handleGraphics
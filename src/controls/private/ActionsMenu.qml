@@ -21,6 +21,10 @@ Controls.Menu
     property Controls.Action parentAction
     property Controls.MenuItem parentItem
 
+    // Items are created the first time the menu is shown, and then kept
+    property bool built: false
+    onAboutToShow: built = true
+
     Item {
         id: invisibleItems
         visible: false
@@ -28,7 +32,7 @@ Controls.Menu
     Instantiator {
         id: actionsInstantiator
 
-        active: theMenu.visible
+        active: theMenu.built
         delegate: QtObject {
             readonly property Controls.Action action: modelData
             property QtObject item: null
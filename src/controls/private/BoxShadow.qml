@@ -0,0 +1,41 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.6
+import org.kde.kirigami 2.12
+
+/**
+ * A shadow below a rectangle or rounded rectangle.
+ *
+ * The shadow follows the geometry and the radius of the source item, which
+ * needs to be either the parent or a sibling of the shadow. It is rendered
+ * with the same distance field as ShadowedRectangle, so unlike the effects of
+ * QtGraphicalEffects it needs no offscreen layer and no blur passes.
+ *
+ * Only the part of the shadow outside of the source is drawn, so the source
+ * may be translucent.
+ */
+ShadowedRectangle {
+    id: boxShadow
+
+    /**
+     * The item casting the shadow.
+     */
+    property Item source
+
+    anchors.fill: source
+    z: -1
+    visible: source !== null && source.visible
+
+    radius: source && source.radius !== undefined ? source.radius : 0
+    color: "transparent"
+
+    shadow {
+        size: Units.gridUnit / 2
+        yOffset: 1
+        color: Qt.rgba(0, 0, 0, 0.4)
+    }
+}
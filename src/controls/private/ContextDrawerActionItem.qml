@@ -12,23 +12,27 @@ import org.kde.kirigami 2.5
 BasicListItem {
     id: listItem
 
-    readonly property bool isSeparator: modelData.hasOwnProperty("separator") && modelData.separator
+    // Not named action, that would make AbstractListItem trigger it as well
+    property QtObject modelAction
 
-    readonly property bool isExpandible: modelData && modelData.hasOwnProperty("expandible") && modelData.expandible
+    readonly property bool isSeparator: modelAction && modelAction.hasOwnProperty("separator") && modelAction.separator
 
-    checked: modelData.checked
-    icon: modelData.icon
+    readonly property bool isExpandible: modelAction && modelAction.hasOwnProperty("expandible") && modelAction.expandible
+
+    readonly property bool hasChildren: modelAction && modelAction.children !== undefined && modelAction.children.length > 0
+
+    checked: modelAction ? modelAction.checked : false
+    icon: modelAction ? modelAction.icon : undefined
     separatorVisible: false
     reserveSpaceForIcon: !isSeparator
     reserveSpaceForLabel: !isSeparator
 
-    label: model ? (model.text ? model.text : model.tooltip) : (modelData.text ? modelData.text : modelData.tooltip)
+    label: modelAction ? (modelAction.text ? modelAction.text : modelAction.tooltip) : ""
     hoverEnabled: (!isExpandible || root.collapsed) && !Settings.tabletMode
     sectionDelegate: isExpandible
     font.pointSize: isExpandible ? Theme.defaultFont.pointSize * 1.30 : Theme.defaultFont.pointSize
 
-    enabled: !isExpandible && !isSeparator && (model ? model.enabled : modelData.enabled)
-    visible: model ? model.visible : modelData.visible
+    enabled: !isExpandible && !isSeparator && modelAction && modelAction.enabled
     opacity: enabled || isExpandible ? 1.0 : 0.6
 
     Separator {
@@ -38,20 +42,24 @@ BasicListItem {
         Layout.fillWidth: true
     }
 
-    ActionsMenu {
-        id: actionsMenu
-        y: Settings.isMobile ? -height : listItem.height
-        z: 99999999
-        actions: modelData.children
-        submenuComponent: Component {
-            ActionsMenu {}
+    // Only created the first time the submenu is opened
+    Loader {
+        id: actionsMenuLoader
+        active: false
+        sourceComponent: ActionsMenu {
+            y: Settings.isMobile ? -height : listItem.height
+            z: 99999999
+            actions: listItem.modelAction.children
+            submenuComponent: Component {
+                ActionsMenu {}
+            }
         }
     }
 
     Loader {
         Layout.fillWidth: true
         Layout.fillHeight: true
-        sourceComponent: modelData.displayComponent
+        sourceComponent: listItem.modelAction ? listItem.modelAction.displayComponent : null
         onStatusChanged: {
             for (var i in parent.children) {
                 var child = parent.children[i];
@@ -73,26 +81,24 @@ BasicListItem {
         selected: listItem.checked || listItem.pressed
         Layout.preferredWidth: Layout.preferredHeight
         source: "go-up-symbolic"
-        visible: !isExpandible  && !listItem.isSeparator && modelData.children!== undefined && modelData.children.length > 0
+        visible: !isExpandible && !listItem.isSeparator && listItem.hasChildren
     }
 
     onPressed: {
-        if (modelData.children.length > 0) {
-            actionsMenu.open();
+        if (hasChildren) {
+            actionsMenuLoader.active = true;
+            actionsMenuLoader.item.open();
         }
     }
     onClicked: {
-        if (modelData.children.length === 0) {
+        if (!hasChildren) {
             root.drawerOpen = false;
         }
 
-        if (modelData && modelData.trigger !== undefined) {
-            modelData.trigger();
-        // assume the model is a list of QAction or Action
-        } else if (menu.model.length > index) {
-            menu.model[index].trigger();
+        if (modelAction && modelAction.trigger !== undefined) {
+            modelAction.trigger();
         } else {
-            console.warning("Don't know how to trigger the action")
+            console.warn("Don't know how to trigger the action")
         }
     }
 }
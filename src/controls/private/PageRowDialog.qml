@@ -0,0 +1,93 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import QtQuick.Controls 2.15
+import QtQuick.Layouts 1.15
+import org.kde.kirigami 2.15 as Kirigami
+
+/**
+ * Container used by PageRow.pushDialogLayer on mobile when the window is wide
+ * enough to show the page in a dialog instead of a layer.
+ * It's loaded once per PageRow and instances are recycled after being closed.
+ * @internal
+ */
+Dialog {
+    id: dialog
+
+    /**
+     * The page currently shown by this dialog, if it has been
+     * instantiated by PageRow it will be destroyed once the dialog closes.
+     */
+    property Item page
+    property bool ownsPage: false
+
+    modal: true
+    leftPadding: 0; rightPadding: 0; topPadding: 0; bottomPadding: 0
+    clip: true
+
+    header: Kirigami.AbstractApplicationHeader {
+        pageRow: null
+        page: null
+        minimumHeight: Kirigami.Units.gridUnit * 1.6
+        maximumHeight: Kirigami.Units.gridUnit * 1.6
+        preferredHeight: Kirigami.Units.gridUnit * 1.6
+
+        Keys.onEscapePressed: {
+            if (dialog.opened) {
+                dialog.close();
+            } else {
+                event.accepted = false;
+            }
+        }
+
+        contentItem: RowLayout {
+            width: parent.width
+            Kirigami.Heading {
+                Layout.leftMargin: Kirigami.Units.largeSpacing
+                text: dialog.title
+                elide: Text.ElideRight
+            }
+            Item {
+                Layout.fillWidth: true
+            }
+            Kirigami.Icon {
+                id: closeIcon
+                Layout.alignment: Qt.AlignVCenter
+                Layout.rightMargin: Kirigami.Units.largeSpacing
+                Layout.preferredHeight: Kirigami.Units.iconSizes.smallMedium
+                Layout.preferredWidth: Kirigami.Units.iconSizes.smallMedium
+                source: closeMouseArea.containsMouse ? "window-close" : "window-close-symbolic"
+                active: closeMouseArea.containsMouse
+                MouseArea {
+                    id: closeMouseArea
+                    hoverEnabled: true
+                    anchors.fill: parent
+                    onClicked: dialog.close();
+                }
+            }
+        }
+    }
+    contentItem: Control { topPadding: 0; leftPadding: 0; rightPadding: 0; bottomPadding: 0 }
+
+    // Detach the page so the dialog can be reused by the next pushDialogLayer call
+    function releasePage() {
+        if (!page) {
+            return;
+        }
+        if (contentItem.contentItem === page) {
+            contentItem.contentItem = null;
+        }
+        if (ownsPage) {
+            page.destroy();
+        } else {
+            page.parent = null;
+        }
+        page = null;
+        ownsPage = false;
+        title = "";
+    }
+}
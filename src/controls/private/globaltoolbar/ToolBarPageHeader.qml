@@ -9,6 +9,7 @@ import QtQuick.Window 2.5
 import QtQuick.Controls 2.0 as Controls
 import QtQuick.Layouts 1.2
 import org.kde.kirigami 2.14
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
 import "../" as Private
 
 
@@ -57,27 +58,11 @@ AbstractPageHeader {
             alignment: pageRow ? pageRow.globalToolBar.toolbarActionAlignment : Qt.AlignRight
             heightMode: ToolBarLayout.ConstrainIfLarger
 
-            actions: {
-                if (!page) {
-                    return []
-                }
-
-                var result = []
-
-                if (page.actions.main) {
-                    result.push(page.actions.main)
-                }
-                if (page.actions.left) {
-                    result.push(page.actions.left)
-                }
-                if (page.actions.right) {
-                    result.push(page.actions.right)
-                }
-                if (page.actions.contextualActions.length > 0) {
-                    result = result.concat(Array.prototype.map.call(page.actions.contextualActions, function(item) { return item }))
-                }
-
-                return result
+            actions: pageActions.actions
+
+            KirigamiPrivate.PageActionCollector {
+                id: pageActions
+                group: page ? page.actions : null
             }
 
             Binding {
@@ -0,0 +1,67 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+import org.kde.kirigami 2.19 as Kirigami
+
+/**
+ * A page whose content is only instantiated when it is needed.
+ *
+ * The page itself only holds what a tab needs to show it, such as its title
+ * and icon. The content is created from ::contentComponent once the page is
+ * loaded, and destroyed again when it is unloaded.
+ *
+ * Inside a SwipeNavigator, LazyPages are loaded when they are the current page
+ * or one of its neighbours, see SwipeNavigator::cacheRange and
+ * SwipeNavigator::retainedPages. Elsewhere, set ::loaded manually.
+ *
+ * @code{.qml}
+ * Kirigami.SwipeNavigator {
+ *     Kirigami.LazyPage {
+ *         title: "Albums"
+ *         icon.name: "media-album-cover"
+ *         contentComponent: AlbumsView {}
+ *     }
+ * }
+ * @endcode
+ *
+ * @since 5.88
+ * @since org.kde.kirigami 2.19
+ */
+Kirigami.Page {
+    id: page
+
+    /**
+     * The component the content of this page is created from. The content is
+     * sized to fill the page.
+     */
+    property Component contentComponent
+
+    /**
+     * Whether the content of this page is instantiated.
+     */
+    property bool loaded: false
+
+    /**
+     * Whether the content is created asynchronously, spread over several
+     * frames. Setting this to false while the content is being created
+     * finishes it right away.
+     */
+    property bool asynchronous: false
+
+    /**
+     * The instantiated content, or null while the page is not loaded.
+     */
+    readonly property Item contentInstance: contentLoader.item
+
+    Loader {
+        id: contentLoader
+        anchors.fill: parent
+        active: page.loaded
+        asynchronous: page.asynchronous
+        sourceComponent: page.contentComponent
+    }
+}
@@ -72,6 +72,41 @@ Item {
      */
     property alias currentIndex: columnView.currentIndex
 
+    /**
+     * cacheRange: int
+     *
+     * How many pages on each side of the current page have their content
+     * instantiated. Only applies to LazyPage, other pages always exist.
+     *
+     * @since 5.88
+     * @since org.kde.kirigami 2.19
+     */
+    property int cacheRange: 1
+
+    /**
+     * retainedPages: int
+     *
+     * How many of the most recently shown LazyPages keep their content when
+     * they are outside of cacheRange, so going back to them does not create
+     * their content again.
+     *
+     * @since 5.88
+     * @since org.kde.kirigami 2.19
+     */
+    property int retainedPages: 0
+
+    /**
+     * asynchronous: bool
+     *
+     * Whether the content of LazyPages next to the current page is created
+     * asynchronously. The content of the current page is always created right
+     * away.
+     *
+     * @since 5.88
+     * @since org.kde.kirigami 2.19
+     */
+    property bool asynchronous: true
+
     /**
      * Pushes a page as a new dialog on desktop and as a layer on mobile.
      * @param page The page can be defined as a component, item or string. If an item is
@@ -111,6 +146,44 @@ Item {
         return item;
     }
 
+    onPagesChanged: _pageLoader.update()
+    onCacheRangeChanged: _pageLoader.update()
+    onRetainedPagesChanged: _pageLoader.update()
+    onAsynchronousChanged: _pageLoader.update()
+
+    QtObject {
+        id: _pageLoader
+
+        // Most recently shown pages first, at most retainedPages of them.
+        property var recentPages: []
+
+        function update() {
+            const pages = Array.from(swipeNavigatorRoot.pages)
+            const current = columnView.currentIndex
+            const currentPage = pages[current]
+            if (!currentPage) {
+                return
+            }
+
+            recentPages = [currentPage].concat(recentPages.filter(page => page !== currentPage && pages.includes(page)))
+                .slice(0, Math.max(1, swipeNavigatorRoot.retainedPages + 1))
+
+            pages.forEach((page, index) => {
+                // We only want the current page to be focusable, so we
+                // disable the inactive pages.
+                page.enabled = index === current
+
+                if (page.contentComponent === undefined) {
+                    return
+                }
+                // Only the current page blocks, a pending neighbour is
+                // finished right away once it becomes current.
+                page.asynchronous = swipeNavigatorRoot.asynchronous && index !== current
+                page.loaded = Math.abs(index - current) <= swipeNavigatorRoot.cacheRange || recentPages.includes(page)
+            })
+        }
+    }
+
     QtObject {
         id: _gridManager
         readonly property bool tall: (_header.width + __main.implicitWidth + Math.abs(__main.offset) + _footer.width) > swipeNavigatorRoot.width
@@ -234,13 +307,9 @@ Item {
 
                 Component.onCompleted: {
                     columnView.currentIndex = swipeNavigatorRoot.initialIndex
+                    _pageLoader.update()
                 }
-                // We only want the current page to be focusable, so we
-                // disable the inactive pages.
-                onCurrentIndexChanged: {
-                    Array.from(swipeNavigatorRoot.pages).forEach(item => item.enabled = false)
-                    swipeNavigatorRoot.pages[currentIndex].enabled = true
-                }
+                onCurrentIndexChanged: _pageLoader.update()
             }
         }
         popEnter: Transition {
@@ -4,8 +4,8 @@
  *  SPDX-License-Identifier: LGPL-2.0-or-later
  */
 
-import QtQuick 2.1
-import QtQuick.Templates 2.2 as T2
+import QtQuick 2.6
+import QtQuick.Templates 2.3 as T2
 import org.kde.kirigami 2.11
 import "private"
 
@@ -279,6 +279,14 @@ T2.Drawer {
 
     interactive: modal
 
+    // Wraps the dimmer of the style, so that it can be faded by the render thread
+    T2.Overlay.modal: Component {
+        Loader {
+            sourceComponent: root.T2.Overlay.overlay ? root.T2.Overlay.overlay.modal : null
+            Component.onCompleted: root.__internal.dimmer = this
+        }
+    }
+
     Theme.inherit: false
     Theme.colorSet: modal ? Theme.View : Theme.Window
     Theme.onColorSetChanged: {
@@ -346,8 +354,12 @@ T2.Drawer {
                     }
                 }
             }
-            SmoothedAnimation {
-                velocity: 5
+            DrawerMotion {
+                drawer: root
+                to: 1
+                handle: drawerHandle
+                dimmer: root.__internal.dimmer
+                renderThread: root.__internal.renderThreadMotion
             }
             ScriptAction {
                 script: enterAnimation.animating = false
@@ -362,8 +374,12 @@ T2.Drawer {
             ScriptAction {
                 script: exitAnimation.animating = true
             }
-            SmoothedAnimation {
-                velocity: 5
+            DrawerMotion {
+                drawer: root
+                to: 0
+                handle: drawerHandle
+                dimmer: root.__internal.dimmer
+                renderThread: root.__internal.renderThreadMotion
             }
             ScriptAction {
                 script: exitAnimation.animating = false
@@ -461,6 +477,10 @@ T2.Drawer {
     property QtObject __internal: QtObject {
         //here in order to not be accessible from outside
         property bool completed: false
+        // Modal drawers are also moved and dimmed on the render thread while
+        // opening and closing
+        readonly property bool renderThreadMotion: root.modal
+        property Item dimmer
         property SequentialAnimation positionResetAnim: SequentialAnimation {
             id: positionResetAnim
             property alias to: internalAnim.to
@@ -12,6 +12,7 @@ import QtQuick.Controls 2.15
 import org.kde.kirigami 2.14
 import QtGraphicalEffects 1.0
 import QtQuick.Templates 2.0 as T2
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
 import "private"
 import "../private"
 
@@ -204,17 +205,10 @@ QtObject {
             root.parent.forceActiveFocus();
         }
     }
-    onHeaderChanged: headerItem.initHeader()
-    onFooterChanged: {
-        footer.parent = footerParent;
-        footer.anchors.fill = footerParent;
-    }
-
     Component.onCompleted: {
         if (!root.parent && typeof applicationWindow !== "undefined") {
             root.parent = applicationWindow().overlay
         }
-        headerItem.initHeader();
     }
 
     readonly property Item rootItem: FocusScope {
@@ -257,6 +251,35 @@ QtObject {
         readonly property int absoluteContentItemMaximumWidth: Math.round(width - Units.largeSpacing * 2)
         readonly property int contentItemMaximumWidth: root.contentItem.Layout.maximumWidth > 0 ? Math.min(root.contentItem.Layout.maximumWidth, absoluteContentItemMaximumWidth) : width > Units.gridUnit * 30 ? width * 0.95 : absoluteContentItemMaximumWidth
 
+        // Resolves sheet width, open position and header and footer placement
+        // once per frame, however many of their inputs change in between.
+        KirigamiPrivate.OverlaySheetLayout {
+            id: sheetLayout
+            objectName: "sheetLayout"
+            anchors.fill: parent
+
+            viewport: outerFlickable
+            sheet: contentLayout
+            headerBar: headerItem
+            footerBar: footerItem
+            header: root.header
+            headerContainer: headerParent
+            footer: root.footer
+            footerContainer: footerParent
+            preferredWidth: mainItem.contentItemPreferredWidth
+            maximumWidth: mainItem.contentItemMaximumWidth
+            open: root.sheetOpen
+
+            onRepositionRequested: {
+                if (openAnimation.running) {
+                    openAnimation.running = false;
+                    root.open();
+                } else {
+                    outerFlickable.adjustPosition();
+                }
+            }
+        }
+
         onHeightChanged: {
             var focusItem;
 
@@ -391,7 +414,7 @@ QtObject {
 
                 y: (scrollView.contentItem != flickableContents ? -scrollView.flickableItem.contentY - listHeaderHeight  - (headerItem.visible ? headerItem.height : 0): 0)
 
-                width: mainItem.contentItemPreferredWidth <= 0 ? mainItem.width : (mainItem.contentItemMaximumWidth > 0 ? Math.min( mainItem.contentItemMaximumWidth, Math.max( mainItem.width/2, mainItem.contentItemPreferredWidth ) ) : Math.max( mainItem.width / 2, mainItem.contentItemPreferredWidth ) )
+                width: sheetLayout.sheetWidth
 
                 implicitHeight: scrollView.contentItem == flickableContents ? root.contentItem.height + topPadding + bottomPadding : 0
                 Connections {
@@ -416,27 +439,6 @@ QtObject {
                 }
             }
 
-            Connections {
-                target: scrollView.flickableItem
-                property real oldContentHeight: 0
-                function onContentHeightChanged() {
-                    if (openAnimation.running) {
-                        openAnimation.running = false;
-                        open();
-                    } else {
-                        // repositioning is relevant only when the content height is less than the viewport height.
-                        // In that case the sheet looks like a dialog and should be centered. there is also a corner case when now is bigger then the viewport but prior to the
-                        // resize event it was smaller, also in this case we need repositioning
-                        if (scrollView.animatedContentHeight < outerFlickable.height
-                            || scrollView.flickableItem.oldContentHeight < outerFlickable.height
-                        ) {
-                            outerFlickable.adjustPosition();
-                        }
-                        oldContentHeight = scrollView.animatedContentHeight
-                    }
-                }
-            }
-
             Flickable {
                 id: outerFlickable
                 anchors.fill: parent
@@ -449,19 +451,9 @@ QtObject {
                 //readonly property int topEmptyArea: Math.max(height-scrollView.animatedContentHeight, Units.gridUnit * 3)
                 readonly property int topEmptyArea: Math.max(height-scrollView.animatedContentHeight, Units.gridUnit * 3)
 
-                readonly property real openPosition: Math.max(0, outerFlickable.height - outerFlickable.contentHeight + headerItem.height + footerItem.height) + height/2 - contentLayout.height/2;
-
-                onOpenPositionChanged: {
-                    if (openAnimation.running) {
-                        openAnimation.running = false;
-                        root.open();
-                    } else if (root.sheetOpen) {
-                        adjustPosition();
-                    }
-                }
+                readonly property real openPosition: sheetLayout.openPosition
 
                 property int oldContentY: NaN
-                property int oldContentHeight: 0
                 property bool lastMovementWasDown: false
                 property real startDraggingPos
                 property bool layoutMovingGuard: false
@@ -553,27 +545,13 @@ QtObject {
                     }
                 }
 
-                onHeightChanged: {
-                    adjustPosition();
-                }
-
-                onContentHeightChanged: {
-                    // repositioning is relevant only when the content height is less than the viewport height.
-                    // In that case the sheet looks like a dialog and should be centered. there is also a corner case when now is bigger then the viewport but prior to the
-                    // resize event it was smaller, also in this case we need repositioning
-                    if (contentHeight < height || oldContentHeight < height) {
-                        adjustPosition();
-                    }
-                    oldContentHeight = contentHeight;
-                }
-
                 ColumnLayout {
                     id: contentLayout
                     spacing: 0
                     // Its events should be filtered but not scrolled
                     parent: outerFlickable
                     anchors.horizontalCenter: parent.horizontalCenter
-                    width: mainItem.contentItemPreferredWidth <= 0 ? mainItem.width : (mainItem.contentItemMaximumWidth > 0 ? Math.min( mainItem.contentItemMaximumWidth, Math.max( mainItem.width/2, mainItem.contentItemPreferredWidth ) ) : Math.max( mainItem.width / 2, mainItem.contentItemPreferredWidth ) ) - root.leftInset - root.rightInset
+                    width: sheetLayout.sheetWidth - root.leftInset - root.rightInset
                     height: Math.min(implicitHeight, parent.height) - root.topInset - root.bottomInset
                     property real initialHeight
 
@@ -601,16 +579,7 @@ QtObject {
                         Theme.colorSet: Theme.Header
                         Theme.inherit: false
                         color: Theme.backgroundColor
-                        
-                        function initHeader() {
-                            if (header) {
-                                header.parent = headerParent;
-                                header.anchors.fill = headerParent;
 
-                                //TODO: special case for actual ListViews
-                            }
-                        }
-                        
                         Item {
                             id: headerParent
                             implicitHeight: header ? header.implicitHeight : 0
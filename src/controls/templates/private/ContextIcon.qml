@@ -5,9 +5,8 @@
  */
 
 import QtQuick 2.1
-import QtQuick.Layouts 1.2
-import QtGraphicalEffects 1.0
 import org.kde.kirigami 2.4
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
 
 Item {
     id: canvas
@@ -16,55 +15,14 @@ Item {
     property OverlayDrawer drawer
     property color color: Theme.textColor
     opacity: 0.8
-    layer.enabled: true
 
-    LayoutMirroring.enabled: false
-    LayoutMirroring.childrenInherit: true
-
-    Item {
-        id: iconRoot
+    KirigamiPrivate.DrawerHandleIcon {
         anchors {
             fill: parent
             margins: Units.smallSpacing
         }
-        property int thickness: 2
-        Rectangle {
-            anchors {
-                horizontalCenter: parent.horizontalCenter
-                top: parent.top
-                //horizontalCenterOffset: -parent.width/2
-                topMargin: (parent.height/2 - iconRoot.thickness/2) * drawer.position
-            }
-            antialiasing: drawer.position != 0
-            transformOrigin: Item.Center
-            width: (1 - drawer.position) * height + drawer.position * (Math.sqrt(2*(parent.width*parent.width)))
-            height: iconRoot.thickness
-            color: canvas.color
-            rotation: 45 * drawer.position
-        }
-
-        Rectangle {
-            anchors.centerIn: parent
-            width: height
-            height: iconRoot.thickness
-            color: canvas.color
-        }
-
-
-        Rectangle {
-            anchors {
-                horizontalCenter: parent.horizontalCenter
-                bottom: parent.bottom
-             //   topMargin: -iconRoot.thickness/2 * drawer.position
-                bottomMargin: (parent.height/2 - iconRoot.thickness/2) * drawer.position
-            }
-            antialiasing: drawer.position != 0
-            transformOrigin: Item.Center
-            width: (1 - drawer.position) * height + drawer.position * (Math.sqrt(2*(parent.width*parent.width)))
-            height: iconRoot.thickness
-            color: canvas.color
-            rotation: -45 * drawer.position
-        }
+        shape: KirigamiPrivate.DrawerHandleIcon.Context
+        position: canvas.drawer ? canvas.drawer.position : 0
+        color: canvas.color
     }
 }
-
@@ -0,0 +1,93 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.6
+import QtQuick.Templates 2.3 as T2
+
+/**
+ * Animates the position of a drawer from its current value to ::to.
+ *
+ * When ::renderThread is true, the popup, its handle and its dimmer are also
+ * moved by animators with the same duration and easing. What is shown then
+ * keeps moving on the render thread even while the GUI thread is busy, while
+ * everything bound to the position still follows it.
+ */
+ParallelAnimation {
+    id: motion
+
+    /**
+     * The drawer to move.
+     */
+    property T2.Drawer drawer
+
+    /**
+     * The position the drawer moves to, between 0 and 1.
+     */
+    property real to
+
+    /**
+     * An item following the edge of the drawer horizontally, such as its handle.
+     */
+    property Item handle
+
+    /**
+     * The item dimming the window behind the drawer, its opacity follows the position.
+     */
+    property Item dimmer
+
+    /**
+     * The speed of the motion, in drawer sizes per second.
+     */
+    property real velocity: 5
+
+    /**
+     * Whether the popup, handle and dimmer are moved on the render thread.
+     */
+    property bool renderThread: false
+
+    readonly property int duration: drawer ? Math.round(Math.abs(to - drawer.position) * 1000 / velocity) : 0
+
+    readonly property Item __popupItem: renderThread && drawer && drawer.background ? drawer.background.parent : null
+    readonly property bool __horizontal: drawer && (drawer.edge === Qt.LeftEdge || drawer.edge === Qt.RightEdge)
+    readonly property int __direction: drawer && (drawer.edge === Qt.LeftEdge || drawer.edge === Qt.TopEdge) ? 1 : -1
+    readonly property real __distance: drawer ? motion.__direction * (motion.to - drawer.position) : 0
+
+    NumberAnimation {
+        target: motion.drawer
+        property: "position"
+        to: motion.to
+        duration: motion.duration
+        easing.type: Easing.InOutQuad
+    }
+    XAnimator {
+        target: motion.__horizontal ? motion.__popupItem : null
+        from: target ? target.x : 0
+        to: target ? target.x + motion.__distance * target.width : 0
+        duration: motion.duration
+        easing.type: Easing.InOutQuad
+    }
+    YAnimator {
+        target: motion.__horizontal ? null : motion.__popupItem
+        from: target ? target.y : 0
+        to: target ? target.y + motion.__distance * target.height : 0
+        duration: motion.duration
+        easing.type: Easing.InOutQuad
+    }
+    XAnimator {
+        target: motion.__horizontal && motion.__popupItem ? motion.handle : null
+        from: target ? target.x : 0
+        to: target ? target.x + motion.__distance * motion.drawer.background.width : 0
+        duration: motion.duration
+        easing.type: Easing.InOutQuad
+    }
+    OpacityAnimator {
+        target: motion.__popupItem ? motion.dimmer : null
+        from: motion.drawer ? motion.drawer.position : 0
+        to: motion.to
+        duration: motion.duration
+        easing.type: Easing.InOutQuad
+    }
+}
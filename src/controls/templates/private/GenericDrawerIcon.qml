@@ -6,7 +6,6 @@
 
 import QtQuick 2.1
 import QtQuick.Layouts 1.2
-import QtGraphicalEffects 1.0
 import org.kde.kirigami 2.4 as Kirigami
 
 Item {
@@ -15,7 +14,6 @@ Item {
     property Kirigami.OverlayDrawer drawer
     property color color: Theme.textColor
     opacity: 0.8
-    layer.enabled: true
 
     Kirigami.Icon {
         selected: drawer.handle.pressed
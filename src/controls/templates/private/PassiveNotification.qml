@@ -4,12 +4,12 @@
  *  SPDX-License-Identifier: LGPL-2.0-or-later
  */
 
-import QtQuick 2.12
+import QtQuick 2.15
 import QtQuick.Controls 2.3 as Controls
 import QtQuick.Layouts 1.2
 import QtQuick.Window 2.2
-import QtGraphicalEffects 1.0
 import org.kde.kirigami 2.12 as Kirigami
+import org.kde.kirigami.private 2.19 as KirigamiPrivate
 
 /*
  * PassiveNotification is a type for small, passive and inline
@@ -59,22 +59,11 @@ Controls.Popup {
 
         open();
 
-        for (let i = 0; i < outerLayout.children.length - 3; ++i) {
-            outerLayout.children[i].close();
-        }
+        notificationsModel.post(message, interval, actionText || "", callBack || null);
+    }
 
-        let delegate = delegateComponent.createObject(outerLayout, {
-            "text": message,
-            "actionText": actionText || "",
-            "callBack": callBack || (function(){}),
-            "interval": interval
-        });
-
-        // Reorder items to have the last on top
-        let children = outerLayout.children;
-        for (let i in children) {
-            children[i].Layout.row = children.length-1-i;
-        }
+    function hideNotification() {
+        notificationsModel.clear();
     }
 
     Kirigami.Theme.inherit: false
@@ -82,93 +71,75 @@ Controls.Popup {
     
     background: Item {}
 
-    contentItem: GridLayout {
-        id: outerLayout
-        columns: 1
+    KirigamiPrivate.PassiveNotificationModel {
+        id: notificationsModel
+        // Nothing expires while the user looks at the notifications
+        paused: !root.visible || hover.hovered
     }
 
-    Component {
-        id: delegateComponent
-        Controls.Control {
-            id: delegate
-            property alias text: label.text
-            property alias actionText: actionButton.text
-            property alias interval: timer.interval
-            property var callBack
-            Layout.alignment: Qt.AlignCenter
-            Layout.bottomMargin: -delegate.height
-            opacity: 0
-            function close() {
-                closeAnim.running = true;
+    contentItem: ListView {
+        id: notificationsView
+
+        implicitWidth: notificationsView.contentItem.childrenRect.width
+        implicitHeight: contentHeight
+        interactive: false
+        spacing: Kirigami.Units.smallSpacing
+
+        model: notificationsModel
+        // Delegates of expired notifications are reused for new ones
+        reuseItems: true
+
+        HoverHandler {
+            id: hover
+        }
+
+        add: Transition {
+            NumberAnimation {
+                property: "opacity"
+                from: 0
+                to: 1
+                duration: Kirigami.Units.longDuration
+                easing.type: Easing.InOutQuad
+            }
+        }
+        remove: Transition {
+            NumberAnimation {
+                property: "opacity"
+                to: 0
+                duration: Kirigami.Units.longDuration
+                easing.type: Easing.InOutQuad
             }
+        }
+        displaced: Transition {
+            NumberAnimation {
+                property: "y"
+                duration: Kirigami.Units.longDuration
+                easing.type: Easing.InOutQuad
+            }
+        }
+
+        delegate: Controls.Control {
+            id: delegate
+
+            x: Math.round((notificationsView.width - width) / 2)
 
             leftPadding: Kirigami.Units.largeSpacing
             rightPadding: Kirigami.Units.largeSpacing
             topPadding: Kirigami.Units.largeSpacing
             bottomPadding: Kirigami.Units.largeSpacing
 
-            Component.onCompleted: openAnim.restart()
-            ParallelAnimation {
-                id: openAnim
-                OpacityAnimator {
-                    target: delegate
-                    from: 0
-                    to: 1
-                    duration: Kirigami.Units.longDuration
-                    easing.type: Easing.InOutQuad
-                }
-                NumberAnimation {
-                    target: delegate
-                    property: "Layout.bottomMargin"
-                    from: -delegate.height
-                    to: 0
-                    duration: Kirigami.Units.longDuration
-                    easing.type: Easing.InOutQuad
-                }
-            }
-
-            SequentialAnimation {
-                id: closeAnim
-                ParallelAnimation {
-                    OpacityAnimator {
-                        target: delegate
-                        from: 1
-                        to: 0
-                        duration: Kirigami.Units.longDuration
-                        easing.type: Easing.InOutQuad
-                    }
-                    NumberAnimation {
-                        target: delegate
-                        property: "Layout.bottomMargin"
-                        to: -delegate.height
-                        duration: Kirigami.Units.longDuration
-                        easing.type: Easing.InOutQuad
-                    }
-                }
-                ScriptAction {
-                    script: delegate.destroy();
-                }
-            }
+            ListView.onReused: opacity = 1
 
             contentItem: RowLayout {
                 id: mainLayout
 
                 Kirigami.Theme.inherit: false
                 Kirigami.Theme.colorSet: root.Kirigami.Theme.colorSet
-                width: mainLayout.width
                 //FIXME: why this is not automatic?
                 implicitHeight: Math.max(label.implicitHeight, actionButton.implicitHeight)
-                HoverHandler {
-                    id: hover
-                }
                 TapHandler {
                     acceptedButtons: Qt.LeftButton
-                    onTapped: delegate.close();
-                }
-                Timer {
-                    id: timer
-                    running: root.visible && !hover.hovered
-                    onTriggered: delegate.close();
+                    onTapped: notificationsModel.remove(index);
                 }
 
                 Controls.Label {
@@ -177,17 +148,14 @@ Controls.Popup {
                     elide: Text.ElideRight
                     wrapMode: Text.WordWrap
                     maximumLineCount: 4
+                    text: model.text
                 }
 
                 Controls.Button {
                     id: actionButton
                     visible: text.length > 0
-                    onClicked: {
-                        delegate.close();;
-                        if (delegate.callBack && (typeof delegate.callBack === "function")) {
-                            delegate.callBack();
-                        }
-                    }
+                    text: model.actionText
+                    onClicked: notificationsModel.trigger(index);
                 }
             }
             background: Kirigami.ShadowedRectangle {
@@ -211,4 +179,3 @@ Controls.Popup {
 
     Controls.Overlay.modeless: Item {}
 }
-
@@ -0,0 +1,220 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "drawerhandleicon.h"
+
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGRectangleNode>
+#include <QSGRendererInterface>
+#include <QtMath>
+
+#include <algorithm>
+
+#include "scenegraph/drawerhandleiconmaterial.h"
+
+// Center of a bar of the given length rotated around the middle of its right end.
+static QPointF rotatedAroundRightEnd(const QPointF &pivot, qreal length, qreal rotation)
+{
+    const qreal radians = qDegreesToRadians(rotation);
+    return pivot - QPointF{length / 2.0 * std::cos(radians), length / 2.0 * std::sin(radians)};
+}
+
+// The same layout as the Rectangle based icons this replaces, in pixels.
+static std::array<DrawerHandleIcon::Bar, 3> layoutBars(DrawerHandleIcon::Shape shape, qreal w, qreal h, qreal t, qreal p)
+{
+    const qreal diagonal = std::sqrt(2.0 * w * w);
+
+    std::array<DrawerHandleIcon::Bar, 3> bars;
+    if (shape == DrawerHandleIcon::Menu) {
+        const qreal length = (1.0 - p) * w + p * diagonal;
+
+        bars[0].rotation = -45.0 * p;
+        bars[0].length = length;
+        bars[0].center = rotatedAroundRightEnd(QPointF{w, -t / 2.0 * p + t / 2.0}, length, bars[0].rotation);
+
+        bars[1].length = w * (1.0 - p);
+        bars[1].center = QPointF{w / 2.0, h / 2.0};
+
+        bars[2].rotation = 45.0 * p;
+        bars[2].length = length;
+        bars[2].center = rotatedAroundRightEnd(QPointF{w, h + t / 2.0 * p - t / 2.0}, length, bars[2].rotation);
+    } else {
+        const qreal length = (1.0 - p) * t + p * diagonal;
+        const qreal offset = (h / 2.0 - t / 2.0) * p;
+
+        bars[0].rotation = 45.0 * p;
+        bars[0].length = length;
+        bars[0].center = QPointF{w / 2.0, offset + t / 2.0};
+
+        bars[1].length = t;
+        bars[1].center = QPointF{w / 2.0, h / 2.0};
+
+        bars[2].rotation = -45.0 * p;
+        bars[2].length = length;
+        bars[2].center = QPointF{w / 2.0, h - offset - t / 2.0};
+    }
+
+    return bars;
+}
+
+DrawerHandleIcon::DrawerHandleIcon(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(QQuickItem::ItemHasContents);
+}
+
+DrawerHandleIcon::Shape DrawerHandleIcon::shape() const
+{
+    return m_shape;
+}
+
+void DrawerHandleIcon::setShape(Shape shape)
+{
+    if (shape == m_shape) {
+        return;
+    }
+
+    m_shape = shape;
+    update();
+    Q_EMIT shapeChanged();
+}
+
+qreal DrawerHandleIcon::position() const
+{
+    return m_position;
+}
+
+void DrawerHandleIcon::setPosition(qreal position)
+{
+    position = qBound(0.0, position, 1.0);
+    if (qFuzzyCompare(position, m_position)) {
+        return;
+    }
+
+    m_position = position;
+    update();
+    Q_EMIT positionChanged();
+}
+
+QColor DrawerHandleIcon::color() const
+{
+    return m_color;
+}
+
+void DrawerHandleIcon::setColor(const QColor &color)
+{
+    if (color == m_color) {
+        return;
+    }
+
+    m_color = color;
+    update();
+    Q_EMIT colorChanged();
+}
+
+qreal DrawerHandleIcon::thickness() const
+{
+    return m_thickness;
+}
+
+void DrawerHandleIcon::setThickness(qreal thickness)
+{
+    if (qFuzzyCompare(thickness, m_thickness)) {
+        return;
+    }
+
+    m_thickness = thickness;
+    update();
+    Q_EMIT thicknessChanged();
+}
+
+QSGNode *DrawerHandleIcon::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data);
+
+    if (width() <= 0.0 || height() <= 0.0 || m_color.alpha() == 0) {
+        delete node;
+        return nullptr;
+    }
+
+    const auto bars = layoutBars(m_shape, width(), height(), m_thickness, m_position);
+
+    if (window()->rendererInterface()->graphicsApi() == QSGRendererInterface::Software) {
+        return updateSoftwareNode(node, bars);
+    }
+
+    auto geometryNode = static_cast<QSGGeometryNode *>(node);
+    if (!geometryNode) {
+        geometryNode = new QSGGeometryNode{};
+        geometryNode->setGeometry(new QSGGeometry{QSGGeometry::defaultAttributes_TexturedPoint2D(), 4});
+        geometryNode->setFlag(QSGNode::OwnsGeometry);
+        geometryNode->setMaterial(new DrawerHandleIconMaterial{});
+        geometryNode->setFlag(QSGNode::OwnsMaterial);
+    }
+
+    const QRectF rect = boundingRect();
+    QSGGeometry::updateTexturedRectGeometry(geometryNode->geometry(), rect, QRectF{0.0, 0.0, 1.0, 1.0});
+    geometryNode->markDirty(QSGNode::DirtyGeometry);
+
+    // Convert to the coordinates used by the shader, centered and in units of
+    // half the smallest dimension.
+    const qreal w = rect.width();
+    const qreal h = rect.height();
+    const qreal scale = 2.0 / std::min(w, h);
+    const QPointF center = QPointF{w / 2.0, h / 2.0};
+
+    auto material = static_cast<DrawerHandleIconMaterial *>(geometryNode->material());
+    material->aspect = w >= h ? QVector2D{float(w / h), 1.0} : QVector2D{1.0, float(h / w)};
+    material->color = QColor::fromRgbF(m_color.redF() * m_color.alphaF(), //
+                                       m_color.greenF() * m_color.alphaF(),
+                                       m_color.blueF() * m_color.alphaF(),
+                                       m_color.alphaF());
+    for (std::size_t i = 0; i < bars.size(); ++i) {
+        // A bar that collapsed entirely would still leave an anti-aliased
+        // hairline, draw the first bar a second time instead.
+        const auto &bar = bars[i].length > 0.0 ? bars[i] : bars[0];
+        const QPointF barCenter = (bar.center - center) * scale;
+        material->bars[i] = QVector4D{float(barCenter.x()), float(barCenter.y()), float(bar.length / 2.0 * scale), float(m_thickness / 2.0 * scale)};
+        const qreal radians = qDegreesToRadians(bar.rotation);
+        material->rotations[i] = QVector2D{float(std::cos(radians)), float(std::sin(radians))};
+    }
+    geometryNode->markDirty(QSGNode::DirtyMaterial);
+
+    return geometryNode;
+}
+
+QSGNode *DrawerHandleIcon::updateSoftwareNode(QSGNode *node, const std::array<Bar, 3> &bars)
+{
+    // The software renderer has no shaders, draw a transformed rectangle per
+    // bar instead.
+    if (!node) {
+        node = new QSGNode{};
+        for (std::size_t i = 0; i < bars.size(); ++i) {
+            auto transformNode = new QSGTransformNode{};
+            transformNode->appendChildNode(window()->createRectangleNode());
+            node->appendChildNode(transformNode);
+        }
+    }
+
+    auto transformNode = static_cast<QSGTransformNode *>(node->firstChild());
+    for (const auto &bar : bars) {
+        QMatrix4x4 matrix;
+        matrix.translate(bar.center.x(), bar.center.y());
+        matrix.rotate(bar.rotation, 0.0, 0.0, 1.0);
+        transformNode->setMatrix(matrix);
+
+        auto rectangleNode = static_cast<QSGRectangleNode *>(transformNode->firstChild());
+        rectangleNode->setRect(QRectF{-bar.length / 2.0, -m_thickness / 2.0, bar.length, m_thickness});
+        rectangleNode->setColor(m_color);
+
+        transformNode = static_cast<QSGTransformNode *>(transformNode->nextSibling());
+    }
+
+    return node;
+}
+
+#include "moc_drawerhandleicon.cpp"
@@ -0,0 +1,93 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <array>
+
+#include <QColor>
+#include <QQuickItem>
+
+/**
+ * The animated icon of a drawer handle.
+ *
+ * Draws the three bars of a hamburger or context menu icon, morphing into an
+ * arrow or a cross as the drawer opens. The bars are rendered directly with a
+ * distance field shader, so animating the icon needs no offscreen layer.
+ */
+class DrawerHandleIcon : public QQuickItem
+{
+    Q_OBJECT
+
+    /**
+     * Which icon to draw.
+     *
+     * * `Menu`: Three horizontal bars, turning into an arrow pointing left.
+     * * `Context`: Three dots, turning into a cross.
+     */
+    Q_PROPERTY(Shape shape READ shape WRITE setShape NOTIFY shapeChanged)
+
+    /**
+     * The progress of the morph, from 0 when closed to 1 when open.
+     * Usually bound to OverlayDrawer::position.
+     */
+    Q_PROPERTY(qreal position READ position WRITE setPosition NOTIFY positionChanged)
+
+    /**
+     * The color of the bars.
+     */
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+
+    /**
+     * The thickness of the bars, in pixels. Defaults to 2.
+     */
+    Q_PROPERTY(qreal thickness READ thickness WRITE setThickness NOTIFY thicknessChanged)
+
+public:
+    enum Shape {
+        Menu,
+        Context,
+    };
+    Q_ENUM(Shape)
+
+    struct Bar {
+        QPointF center;
+        qreal length = 0.0;
+        // In degrees, clockwise.
+        qreal rotation = 0.0;
+    };
+
+    explicit DrawerHandleIcon(QQuickItem *parent = nullptr);
+
+    Shape shape() const;
+    void setShape(Shape shape);
+
+    qreal position() const;
+    void setPosition(qreal position);
+
+    QColor color() const;
+    void setColor(const QColor &color);
+
+    qreal thickness() const;
+    void setThickness(qreal thickness);
+
+Q_SIGNALS:
+    void shapeChanged();
+    void positionChanged();
+    void colorChanged();
+    void thicknessChanged();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data) override;
+
+private:
+    QSGNode *updateSoftwareNode(QSGNode *node, const std::array<Bar, 3> &bars);
+
+    Shape m_shape = Menu;
+    qreal m_position = 0.0;
+    QColor m_color = Qt::black;
+    qreal m_thickness = 2.0;
+};
@@ -0,0 +1,206 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "herotransition.h"
+
+#include <QQuickWindow>
+#include <QSGRendererInterface>
+
+#include "scenegraph/herotransitionnode.h"
+
+HeroTransition::HeroTransition(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(QQuickItem::ItemHasContents);
+
+    // Only used when nothing is rendered, otherwise the node tells when the
+    // animation is done.
+    m_finishTimer.setSingleShot(true);
+    connect(&m_finishTimer, &QTimer::timeout, this, &HeroTransition::stop);
+}
+
+QQuickItem *HeroTransition::source() const
+{
+    return m_source;
+}
+
+void HeroTransition::setSource(QQuickItem *source)
+{
+    if (source == m_source) {
+        return;
+    }
+
+    m_source = source;
+    update();
+    Q_EMIT sourceChanged();
+}
+
+QQuickItem *HeroTransition::destination() const
+{
+    return m_destination;
+}
+
+void HeroTransition::setDestination(QQuickItem *destination)
+{
+    if (destination == m_destination) {
+        return;
+    }
+
+    m_destination = destination;
+    update();
+    Q_EMIT destinationChanged();
+}
+
+QQuickItem *HeroTransition::mask() const
+{
+    return m_mask;
+}
+
+void HeroTransition::setMask(QQuickItem *mask)
+{
+    if (mask == m_mask) {
+        return;
+    }
+
+    m_mask = mask;
+    update();
+    Q_EMIT maskChanged();
+}
+
+QRectF HeroTransition::sourceRect() const
+{
+    return m_sourceRect;
+}
+
+void HeroTransition::setSourceRect(const QRectF &rect)
+{
+    if (rect == m_sourceRect) {
+        return;
+    }
+
+    m_sourceRect = rect;
+    update();
+    Q_EMIT sourceRectChanged();
+}
+
+QRectF HeroTransition::destinationRect() const
+{
+    return m_destinationRect;
+}
+
+void HeroTransition::setDestinationRect(const QRectF &rect)
+{
+    if (rect == m_destinationRect) {
+        return;
+    }
+
+    m_destinationRect = rect;
+    update();
+    Q_EMIT destinationRectChanged();
+}
+
+int HeroTransition::duration() const
+{
+    return m_duration;
+}
+
+void HeroTransition::setDuration(int duration)
+{
+    if (duration == m_duration) {
+        return;
+    }
+
+    m_duration = duration;
+    Q_EMIT durationChanged();
+}
+
+QEasingCurve HeroTransition::easing() const
+{
+    return m_easing;
+}
+
+void HeroTransition::setEasing(const QEasingCurve &easing)
+{
+    if (easing == m_easing) {
+        return;
+    }
+
+    m_easing = easing;
+    Q_EMIT easingChanged();
+}
+
+bool HeroTransition::isRunning() const
+{
+    return m_running;
+}
+
+void HeroTransition::start()
+{
+    if (m_running) {
+        return;
+    }
+
+    m_running = true;
+    m_started = true;
+    ++m_run;
+    if (!window() || !isVisible() || !m_source || !m_destination || window()->rendererInterface()->graphicsApi() == QSGRendererInterface::Software) {
+        m_finishTimer.start(m_duration);
+    }
+    update();
+    Q_EMIT runningChanged();
+}
+
+void HeroTransition::stop()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+    m_finishTimer.stop();
+    update();
+    Q_EMIT runningChanged();
+    Q_EMIT finished();
+}
+
+QSGNode *HeroTransition::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data);
+
+    if (!m_running || !m_source || !m_destination || window()->rendererInterface()->graphicsApi() == QSGRendererInterface::Software) {
+        delete node;
+        return nullptr;
+    }
+
+    auto transitionNode = static_cast<HeroTransitionNode *>(node);
+    if (!transitionNode) {
+        transitionNode = new HeroTransitionNode{};
+        // Emitted on the render thread, the connection goes away with either end.
+        connect(
+            transitionNode,
+            &HeroTransitionNode::finished,
+            this,
+            [this](int run) {
+                if (run == m_run) {
+                    stop();
+                }
+            },
+            Qt::QueuedConnection);
+    }
+
+    transitionNode->setTextureSources(m_source->textureProvider(), m_destination->textureProvider(), m_mask ? m_mask->textureProvider() : nullptr);
+    transitionNode->setRects(m_sourceRect, m_destinationRect);
+    transitionNode->setAnimation(m_duration, m_easing);
+
+    if (m_started) {
+        m_started = false;
+        transitionNode->start(window(), m_run);
+    }
+
+    return transitionNode;
+}
+
+#include "moc_herotransition.cpp"
@@ -0,0 +1,132 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QEasingCurve>
+#include <QPointer>
+#include <QQuickItem>
+#include <QTimer>
+
+/**
+ * Renders a hero transition from snapshots of its two ends.
+ *
+ * Source and destination are texture providers, usually ShaderEffectSource
+ * items holding a snapshot that is taken once when the transition starts.
+ * The movement, fade and mask of the transition are computed on the render
+ * thread, so the GUI thread is free while the transition runs. The transition
+ * ends once its last frame was rendered.
+ *
+ * This is the engine behind Hero.
+ */
+class HeroTransition : public QQuickItem
+{
+    Q_OBJECT
+
+    /**
+     * The texture provider showing the item the transition starts from.
+     */
+    Q_PROPERTY(QQuickItem *source READ source WRITE setSource NOTIFY sourceChanged)
+
+    /**
+     * The texture provider showing the item the transition ends at.
+     */
+    Q_PROPERTY(QQuickItem *destination READ destination WRITE setDestination NOTIFY destinationChanged)
+
+    /**
+     * An optional texture provider whose alpha masks the destination. When
+     * not set, the destination is masked by a circle turning into a rectangle.
+     */
+    Q_PROPERTY(QQuickItem *mask READ mask WRITE setMask NOTIFY maskChanged)
+
+    /**
+     * The geometry of the source, in the coordinates of this item.
+     */
+    Q_PROPERTY(QRectF sourceRect READ sourceRect WRITE setSourceRect NOTIFY sourceRectChanged)
+
+    /**
+     * The geometry of the destination, in the coordinates of this item.
+     */
+    Q_PROPERTY(QRectF destinationRect READ destinationRect WRITE setDestinationRect NOTIFY destinationRectChanged)
+
+    /**
+     * The duration of the transition, in milliseconds.
+     */
+    Q_PROPERTY(int duration READ duration WRITE setDuration NOTIFY durationChanged)
+
+    /**
+     * The easing curve of the transition.
+     */
+    Q_PROPERTY(QEasingCurve easing READ easing WRITE setEasing NOTIFY easingChanged)
+
+    /**
+     * Whether the transition is currently running.
+     */
+    Q_PROPERTY(bool running READ isRunning NOTIFY runningChanged)
+
+public:
+    explicit HeroTransition(QQuickItem *parent = nullptr);
+
+    QQuickItem *source() const;
+    void setSource(QQuickItem *source);
+
+    QQuickItem *destination() const;
+    void setDestination(QQuickItem *destination);
+
+    QQuickItem *mask() const;
+    void setMask(QQuickItem *mask);
+
+    QRectF sourceRect() const;
+    void setSourceRect(const QRectF &rect);
+
+    QRectF destinationRect() const;
+    void setDestinationRect(const QRectF &rect);
+
+    int duration() const;
+    void setDuration(int duration);
+
+    QEasingCurve easing() const;
+    void setEasing(const QEasingCurve &easing);
+
+    bool isRunning() const;
+
+    /**
+     * Start the transition. Does nothing if it is already running.
+     */
+    Q_INVOKABLE void start();
+
+    /**
+     * Stop the transition immediately. finished() is emitted.
+     */
+    Q_INVOKABLE void stop();
+
+Q_SIGNALS:
+    void sourceChanged();
+    void destinationChanged();
+    void maskChanged();
+    void sourceRectChanged();
+    void destinationRectChanged();
+    void durationChanged();
+    void easingChanged();
+    void runningChanged();
+    void finished();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data) override;
+
+private:
+    QPointer<QQuickItem> m_source;
+    QPointer<QQuickItem> m_destination;
+    QPointer<QQuickItem> m_mask;
+    QRectF m_sourceRect;
+    QRectF m_destinationRect;
+    int m_duration = 250;
+    QEasingCurve m_easing = QEasingCurve::InOutQuad;
+    bool m_running = false;
+    bool m_started = false;
+    int m_run = 0;
+    QTimer m_finishTimer;
+};
@@ -6,7 +6,10 @@
  */
 
 #include "icon.h"
+#include "icondistancefield.h"
+#include "libkirigami/embeddedicons_p.h"
 #include "libkirigami/platformtheme.h"
+#include "scenegraph/distancefieldiconnode.h"
 #include "scenegraph/managedtexturenode.h"
 
 #include "loggingcategory.h"
@@ -25,6 +28,11 @@
 
 Q_GLOBAL_STATIC(ImageTexturesCache, s_iconImageCache)
 
+static QSize distanceFieldContentSize(const QImage &field)
+{
+    return field.size() - QSize(IconDistanceField::Spread, IconDistanceField::Spread) * 2;
+}
+
 Icon::Icon(QQuickItem *parent)
     : QQuickItem(parent)
     , m_changed(false)
@@ -134,6 +142,7 @@ void Icon::setIsMask(bool mask)
 
     m_isMask = mask;
     m_isMaskHeuristic = mask;
+    m_distanceFieldKey.clear();
     polish();
     Q_EMIT isMaskChanged();
 }
@@ -166,6 +175,31 @@ QSGNode *Icon::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *
         return Q_NULLPTR;
     }
 
+    if (!m_distanceField.isNull() && (m_changed || node == nullptr)) {
+        DistanceFieldIconNode *dfNode = dynamic_cast<DistanceFieldIconNode *>(node);
+        if (!dfNode) {
+            delete node;
+            dfNode = new DistanceFieldIconNode;
+        }
+
+        // The field covers the icon plus some padding, so scale it like an
+        // image with the icon's aspect ratio and then grow it by the padding.
+        const QSizeF contentSize = distanceFieldContentSize(m_distanceField);
+        QRectF destination(QPointF(0, 0), contentSize.scaled(size(), Qt::KeepAspectRatio));
+        destination.moveCenter(QRectF(QPointF(0, 0), size()).center());
+        const qreal scale = destination.width() / contentSize.width();
+        const qreal padding = IconDistanceField::Spread * scale;
+
+        dfNode->setRect(destination.adjusted(-padding, -padding, padding, padding));
+        dfNode->setTexture(s_iconImageCache->loadTexture(window(), m_distanceField));
+        dfNode->setColor(m_tintColor);
+        // Field values change by 1 / (2 * Spread) per pixel of the field,
+        // smooth over one device pixel around the outline.
+        dfNode->setSmoothing(0.25 / (IconDistanceField::Spread * scale * window()->effectiveDevicePixelRatio()));
+        m_changed = false;
+        return dfNode;
+    }
+
     if (m_changed || node == nullptr) {
         const QSize itemSize(width(), height());
         QRect nodeRect(QPoint(0, 0), itemSize);
@@ -251,7 +285,7 @@ void Icon::handleFinished(QNetworkReply *reply)
         qCWarning(KirigamiLog) << "received broken image" << reply->url();
 
         // broken image from data, inform the user of this with some useful broken-image thing...
-        const QIcon icon = QIcon::fromTheme(m_fallback);
+        const QIcon icon = Kirigami::EmbeddedIcons::fromTheme(m_fallback);
         m_loadedImage = icon.pixmap(window(), icon.actualSize(size().toSize()), iconMode(), QIcon::On).toImage();
     }
 
@@ -271,54 +305,35 @@ void Icon::updatePolish()
 
     const QSize itemSize(width(), height());
     if (itemSize.width() != 0 && itemSize.height() != 0) {
+        m_tintColor = //
+            !m_color.isValid() || m_color == Qt::transparent //
+            ? (m_selected ? m_theme->highlightedTextColor() : m_theme->textColor())
+            : m_color;
+
+        if (m_renderMode == DistanceField && updateDistanceField()) {
+            m_changed = true;
+            updatePaintedGeometry();
+            update();
+            return;
+        }
+        m_distanceField = QImage();
+
         const auto multiplier =
             QCoreApplication::instance()->testAttribute(Qt::AA_UseHighDpiPixmaps) ? 1 : (window() ? window()->devicePixelRatio() : qGuiApp->devicePixelRatio());
         const QSize size = itemSize * multiplier;
 
-        switch (m_source.type()) {
-        case QVariant::Pixmap:
-            m_icon = m_source.value<QPixmap>().toImage();
-            break;
-        case QVariant::Image:
-            m_icon = m_source.value<QImage>();
-            break;
-        case QVariant::Bitmap:
-            m_icon = m_source.value<QBitmap>().toImage();
-            break;
-        case QVariant::Icon: {
-            const QIcon icon = m_source.value<QIcon>();
-            m_icon = icon.pixmap(window(), icon.actualSize(itemSize), iconMode(), QIcon::On).toImage();
-            break;
-        }
-        case QVariant::Url:
-        case QVariant::String:
-            m_icon = findIcon(size);
-            break;
-        case QVariant::Brush:
-            // todo: fill here too?
-        case QVariant::Color:
-            m_icon = QImage(size, QImage::Format_Alpha8);
-            m_icon.fill(m_source.value<QColor>());
-            break;
-        default:
-            break;
-        }
+        m_icon = loadIcon(itemSize, size);
 
         if (m_icon.isNull()) {
             m_icon = QImage(size, QImage::Format_Alpha8);
             m_icon.fill(Qt::transparent);
         }
 
-        const QColor tintColor = //
-            !m_color.isValid() || m_color == Qt::transparent //
-            ? (m_selected ? m_theme->highlightedTextColor() : m_theme->textColor())
-            : m_color;
-
         // TODO: initialize m_isMask with icon.isMask()
-        if (tintColor.alpha() > 0 && (isMask() || guessMonochrome(m_icon))) {
+        if (m_tintColor.alpha() > 0 && (isMask() || guessMonochrome(m_icon))) {
             QPainter p(&m_icon);
             p.setCompositionMode(QPainter::CompositionMode_SourceIn);
-            p.fillRect(m_icon.rect(), tintColor);
+            p.fillRect(m_icon.rect(), m_tintColor);
             p.end();
         }
     }
@@ -327,6 +342,96 @@ void Icon::updatePolish()
     update();
 }
 
+QImage Icon::loadIcon(const QSize &itemSize, const QSize &size)
+{
+    switch (m_source.type()) {
+    case QVariant::Pixmap:
+        return m_source.value<QPixmap>().toImage();
+    case QVariant::Image:
+        return m_source.value<QImage>();
+    case QVariant::Bitmap:
+        return m_source.value<QBitmap>().toImage();
+    case QVariant::Icon: {
+        const QIcon icon = m_source.value<QIcon>();
+        return icon.pixmap(window(), icon.actualSize(itemSize), iconMode(), QIcon::On).toImage();
+    }
+    case QVariant::Url:
+    case QVariant::String:
+        return findIcon(size);
+    case QVariant::Brush:
+        // todo: fill here too?
+    case QVariant::Color: {
+        QImage image(size, QImage::Format_Alpha8);
+        image.fill(m_source.value<QColor>());
+        return image;
+    }
+    default:
+        return QImage();
+    }
+}
+
+QString Icon::distanceFieldKey() const
+{
+    QString source;
+    switch (m_source.type()) {
+    case QVariant::Icon:
+        source = QStringLiteral("qicon:") + QString::number(m_source.value<QIcon>().cacheKey());
+        break;
+    case QVariant::Url:
+    case QVariant::String:
+        source = m_source.toString();
+        // Remote images are hardly ever symbolic and may still be loading.
+        if (source.startsWith(QLatin1String("http://")) || source.startsWith(QLatin1String("https://"))) {
+            return QString();
+        }
+        break;
+    default:
+        return QString();
+    }
+
+    return QIcon::themeName() + QLatin1Char(':') + QString::number(iconMode()) + QLatin1Char(':') + source;
+}
+
+bool Icon::updateDistanceField()
+{
+    if (!window() || window()->rendererInterface()->graphicsApi() != QSGRendererInterface::OpenGL || m_tintColor.alpha() == 0) {
+        return false;
+    }
+
+    const QString key = distanceFieldKey();
+    if (key.isEmpty()) {
+        m_distanceFieldKey.clear();
+        return false;
+    }
+
+    auto distanceFields = IconDistanceField::self();
+    m_distanceField = distanceFields->field(key);
+    if (!m_distanceField.isNull()) {
+        m_distanceFieldKey = key;
+        setStatus(Ready);
+        return true;
+    }
+
+    if (key == m_distanceFieldKey && distanceFields->isPending(key)) {
+        return false;
+    }
+
+    // Only icons that would be tinted make sense as a distance field, check
+    // that on a rasterization at the reference size before generating one.
+    const QSize referenceSize(IconDistanceField::ReferenceSize, IconDistanceField::ReferenceSize);
+    const QImage reference = loadIcon(referenceSize, referenceSize);
+    const bool loaded = m_source.type() == QVariant::Icon || m_status == Ready;
+    if (!loaded || reference.isNull() || !(isMask() || guessMonochrome(reference))) {
+        m_distanceFieldKey.clear();
+        return false;
+    }
+
+    m_distanceFieldKey = key;
+    const QSize sourceSize = referenceSize * IconDistanceField::Oversampling;
+    distanceFields->request(key, loadIcon(sourceSize, sourceSize));
+    return false;
+}
+
 QImage Icon::findIcon(const QSize &size)
 {
     QImage img;
@@ -373,7 +478,7 @@ QImage Icon::findIcon(const QSize &size)
                     }
                     if (m_loadedImage.isNull()) {
                         // broken image from data, inform the user of this with some useful broken-image thing...
-                        const QIcon icon = QIcon::fromTheme(m_fallback);
+                        const QIcon icon = Kirigami::EmbeddedIcons::fromTheme(m_fallback);
                         m_loadedImage = icon.pixmap(window(), icon.actualSize(QSize(width(), height())), iconMode(), QIcon::On).toImage();
                         setStatus(Error);
                     } else {
@@ -383,7 +488,7 @@ QImage Icon::findIcon(const QSize &size)
                 }
             });
             // Temporary icon while we wait for the real image to load...
-            const QIcon icon = QIcon::fromTheme(m_placeholder);
+            const QIcon icon = Kirigami::EmbeddedIcons::fromTheme(m_placeholder);
             img = icon.pixmap(window(), icon.actualSize(size), iconMode(), QIcon::On).toImage();
             break;
         }
@@ -394,7 +499,7 @@ QImage Icon::findIcon(const QSize &size)
             }
             if (img.isNull()) {
                 // broken image from data, or the texture factory wasn't healthy, inform the user of this with some useful broken-image thing...
-                const QIcon icon = QIcon::fromTheme(m_fallback);
+                const QIcon icon = Kirigami::EmbeddedIcons::fromTheme(m_fallback);
                 img = icon.pixmap(window(), icon.actualSize(QSize(width(), height())), iconMode(), QIcon::On).toImage();
                 setStatus(Error);
             } else {
@@ -424,7 +529,7 @@ QImage Icon::findIcon(const QSize &size)
             });
         }
         // Temporary icon while we wait for the real image to load...
-        const QIcon icon = QIcon::fromTheme(m_placeholder);
+        const QIcon icon = Kirigami::EmbeddedIcons::fromTheme(m_placeholder);
         img = icon.pixmap(window(), icon.actualSize(size), iconMode(), QIcon::On).toImage();
     } else {
         if (iconSource.startsWith(QLatin1String("qrc:/"))) {
@@ -461,7 +566,7 @@ QImage Icon::findIcon(const QSize &size)
 
     if (!iconSource.isEmpty() && img.isNull()) {
         setStatus(Error);
-        const QIcon icon = QIcon::fromTheme(m_fallback);
+        const QIcon icon = Kirigami::EmbeddedIcons::fromTheme(m_fallback);
         img = icon.pixmap(window(), icon.actualSize(size), iconMode(), QIcon::On).toImage();
     }
     return img;
@@ -590,22 +695,51 @@ qreal Icon::paintedHeight() const
     return m_paintedHeight;
 }
 
+Icon::RenderMode Icon::renderMode() const
+{
+    return m_renderMode;
+}
+
+void Icon::setRenderMode(RenderMode renderMode)
+{
+    if (renderMode == m_renderMode) {
+        return;
+    }
+
+    m_renderMode = renderMode;
+
+    if (m_renderMode == DistanceField) {
+        connect(IconDistanceField::self(), &IconDistanceField::fieldReady, this, [this](const QString &key) {
+            if (key == m_distanceFieldKey) {
+                polish();
+            }
+        });
+    } else {
+        disconnect(IconDistanceField::self(), &IconDistanceField::fieldReady, this, nullptr);
+        m_distanceFieldKey.clear();
+    }
+
+    polish();
+    Q_EMIT renderModeChanged();
+}
+
 void Icon::updatePaintedGeometry()
 {
     qreal newWidth = 0.0;
     qreal newHeight = 0.0;
-    if (!m_icon.width() || !m_icon.height()) {
+    const QSize iconSize = m_distanceField.isNull() ? m_icon.size() : distanceFieldContentSize(m_distanceField);
+    if (!iconSize.width() || !iconSize.height()) {
         newWidth = newHeight = 0.0;
     } else {
-        const qreal w = widthValid() ? width() : m_icon.size().width();
-        const qreal widthScale = w / m_icon.size().width();
-        const qreal h = heightValid() ? height() : m_icon.size().height();
-        const qreal heightScale = h / m_icon.size().height();
+        const qreal w = widthValid() ? width() : iconSize.width();
+        const qreal widthScale = w / iconSize.width();
+        const qreal h = heightValid() ? height() : iconSize.height();
+        const qreal heightScale = h / iconSize.height();
         if (widthScale <= heightScale) {
             newWidth = w;
-            newHeight = widthScale * m_icon.size().height();
+            newHeight = widthScale * iconSize.height();
         } else if (heightScale < widthScale) {
-            newWidth = heightScale * m_icon.size().width();
+            newWidth = heightScale * iconSize.width();
             newHeight = h;
         }
     }
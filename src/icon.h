@@ -146,6 +146,27 @@ class Icon : public QQuickItem
      * @since 5.15
      */
     Q_PROPERTY(qreal paintedHeight READ paintedHeight NOTIFY paintedAreaChanged)
+
+    /**
+     * How this icon is rendered.
+     *
+     * When set to `Icon.DistanceField`, icons that are drawn as a mask (see
+     * `isMask`) or that look monochrome are rendered from a signed distance
+     * field. The field is generated once per icon in the background and shared
+     * by all icons showing the same source, regardless of their size or the
+     * screen they are on. Resizing such an icon does not need to load it again
+     * and changing its color only changes a shader parameter.
+     *
+     * Other icons, or icons rendered with a graphics API other than OpenGL,
+     * are always rendered as an image. The default is `Icon.Default`.
+     *
+     * @note Distance fields keep the outline of an icon but lose fine details
+     * smaller than a pixel at the reference size, so this is best suited for
+     * symbolic icons.
+     *
+     * @since 5.88
+     */
+    Q_PROPERTY(Icon::RenderMode renderMode READ renderMode WRITE setRenderMode NOTIFY renderModeChanged)
 public:
     enum Status {
         Null = 0, /// No icon has been set
@@ -155,6 +176,12 @@ public:
     };
     Q_ENUM(Status)
 
+    enum RenderMode {
+        Default = 0, /// Render the icon as an image rasterized at the icon's size
+        DistanceField, /// Render monochrome icons from a size independent signed distance field
+    };
+    Q_ENUM(RenderMode)
+
     Icon(QQuickItem *parent = nullptr);
     ~Icon() override;
 
@@ -186,6 +213,9 @@ public:
     qreal paintedWidth() const;
     qreal paintedHeight() const;
 
+    RenderMode renderMode() const;
+    void setRenderMode(RenderMode renderMode);
+
     QSGNode *updatePaintNode(QSGNode *node, UpdatePaintNodeData *data) override;
 
 Q_SIGNALS:
@@ -199,10 +229,14 @@ Q_SIGNALS:
     void placeholderChanged(const QString &placeholder);
     void statusChanged();
     void paintedAreaChanged();
+    void renderModeChanged();
 
 protected:
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
     QImage findIcon(const QSize &size);
+    QImage loadIcon(const QSize &itemSize, const QSize &size);
+    bool updateDistanceField();
+    QString distanceFieldKey() const;
     void handleFinished(QNetworkReply *reply);
     void handleRedirect(QNetworkReply *reply);
     QIcon::Mode iconMode() const;
@@ -230,4 +264,9 @@ private:
     qreal m_paintedHeight = 0.0;
 
     QImage m_icon;
+
+    RenderMode m_renderMode = Default;
+    QColor m_tintColor;
+    QString m_distanceFieldKey;
+    QImage m_distanceField;
 };
@@ -0,0 +1,184 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "icondistancefield.h"
+
+#include <QFutureWatcher>
+#include <QVector>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+
+class IconDistanceFieldSingleton
+{
+public:
+    IconDistanceField self;
+};
+
+Q_GLOBAL_STATIC(IconDistanceFieldSingleton, privateIconDistanceFieldSelf)
+
+// Fields are tiny, a few kilobytes each, so this holds a lot of icons.
+static const int s_maximumCacheCost = 4096; // KiB
+
+static const float s_infinity = 1e20f;
+
+// One dimensional squared euclidean distance transform, as described in
+// "Distance Transforms of Sampled Functions" by Felzenszwalb and Huttenlocher.
+static void distanceTransform(const float *f, float *d, int *v, float *z, int n)
+{
+    int k = 0;
+    v[0] = 0;
+    z[0] = -s_infinity;
+    z[1] = s_infinity;
+
+    for (int q = 1; q < n; ++q) {
+        float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+        while (s <= z[k]) {
+            --k;
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+        }
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = s_infinity;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; ++q) {
+        while (z[k + 1] < q) {
+            ++k;
+        }
+        d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+    }
+}
+
+static void distanceTransform(QVector<float> &grid, int width, int height)
+{
+    const int n = qMax(width, height);
+    QVector<float> f(n);
+    QVector<float> d(n);
+    QVector<float> z(n + 1);
+    QVector<int> v(n);
+
+    for (int x = 0; x < width; ++x) {
+        for (int y = 0; y < height; ++y) {
+            f[y] = grid[y * width + x];
+        }
+        distanceTransform(f.constData(), d.data(), v.data(), z.data(), height);
+        for (int y = 0; y < height; ++y) {
+            grid[y * width + x] = d[y];
+        }
+    }
+
+    for (int y = 0; y < height; ++y) {
+        float *row = grid.data() + y * width;
+        std::copy(row, row + width, f.begin());
+        distanceTransform(f.constData(), d.data(), v.data(), z.data(), width);
+        std::copy(d.constBegin(), d.constBegin() + width, row);
+    }
+}
+
+IconDistanceField::IconDistanceField()
+{
+    m_fields.setMaxCost(s_maximumCacheCost);
+}
+
+IconDistanceField *IconDistanceField::self()
+{
+    return &privateIconDistanceFieldSelf()->self;
+}
+
+QImage IconDistanceField::field(const QString &key) const
+{
+    const QImage *field = m_fields.object(key);
+    return field ? *field : QImage();
+}
+
+bool IconDistanceField::isPending(const QString &key) const
+{
+    return m_pending.contains(key);
+}
+
+void IconDistanceField::request(const QString &key, const QImage &source)
+{
+    if (source.isNull() || m_pending.contains(key) || m_fields.contains(key)) {
+        return;
+    }
+
+    m_pending.insert(key);
+
+    auto watcher = new QFutureWatcher<QImage>(this);
+    connect(watcher, &QFutureWatcher<QImage>::finished, this, [this, watcher, key]() {
+        watcher->deleteLater();
+        m_pending.remove(key);
+
+        const QImage field = watcher->result();
+        if (field.isNull()) {
+            return;
+        }
+
+        m_fields.insert(key, new QImage(field), field.sizeInBytes() / 1024 + 1);
+        Q_EMIT fieldReady(key);
+    });
+    watcher->setFuture(QtConcurrent::run([source]() {
+        return generate(source, Spread, Oversampling);
+    }));
+}
+
+QImage IconDistanceField::generate(const QImage &source, int spread, int oversampling)
+{
+    if (source.isNull() || spread <= 0) {
+        return QImage();
+    }
+
+    oversampling = qMax(oversampling, 1);
+
+    const QImage alpha = source.convertToFormat(QImage::Format_Alpha8);
+    const int padding = spread * oversampling;
+    const int width = alpha.width() + padding * 2;
+    const int height = alpha.height() + padding * 2;
+
+    // Squared distance to the nearest pixel inside the shape, zero inside it,
+    // and squared distance to the nearest pixel outside, zero outside.
+    QVector<float> outside(width * height, s_infinity);
+    QVector<float> inside(width * height, 0.0f);
+
+    for (int y = 0; y < alpha.height(); ++y) {
+        const uchar *line = alpha.constScanLine(y);
+        for (int x = 0; x < alpha.width(); ++x) {
+            if (line[x] >= 128) {
+                const int index = (y + padding) * width + x + padding;
+                outside[index] = 0.0f;
+                inside[index] = s_infinity;
+            }
+        }
+    }
+
+    distanceTransform(outside, width, height);
+    distanceTransform(inside, width, height);
+
+    // Map the signed distance to [0, 1] with the outline at 0.5. Distances are
+    // measured between pixel centers, so the outline sits half a pixel away.
+    QImage field(width, height, QImage::Format_Grayscale8);
+    const float range = 2.0f * padding;
+    for (int y = 0; y < height; ++y) {
+        uchar *line = field.scanLine(y);
+        for (int x = 0; x < width; ++x) {
+            const int index = y * width + x;
+            const float distance = outside[index] > 0.0f ? std::sqrt(outside[index]) - 0.5f : 0.5f - std::sqrt(inside[index]);
+            const float value = 0.5f - distance / range;
+            line[x] = uchar(qBound(0, int(std::lround(value * 255.0f)), 255));
+        }
+    }
+
+    if (oversampling > 1) {
+        field = field.scaled(width / oversampling, height / oversampling, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)
+                    .convertToFormat(QImage::Format_Grayscale8);
+    }
+
+    return field;
+}
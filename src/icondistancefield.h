@@ -0,0 +1,83 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QImage>
+#include <QObject>
+#include <QSet>
+
+/**
+ * A process wide cache of signed distance fields for monochrome icons.
+ *
+ * Icons using Icon::DistanceField are rasterized once at a fixed reference
+ * size and turned into a distance field on a worker thread. The resulting
+ * field is independent of the size the icon is displayed at, so all items
+ * showing the same icon share a single image and a single texture per window.
+ *
+ * Field values are stored in a Grayscale8 image, where 0.5 is the outline
+ * of the icon, larger values are inside and smaller values are outside. The
+ * field is padded by Spread pixels on every side.
+ */
+class IconDistanceField : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * The size of the icon content inside a distance field, in pixels.
+     */
+    static constexpr int ReferenceSize = 64;
+    /**
+     * The distance in pixels that the field covers around the outline.
+     */
+    static constexpr int Spread = 6;
+    /**
+     * The factor by which the icon is oversampled while generating the field.
+     */
+    static constexpr int Oversampling = 4;
+
+    static IconDistanceField *self();
+
+    /**
+     * @returns the field stored under @p key, or a null image if none was
+     * generated yet.
+     */
+    QImage field(const QString &key) const;
+
+    /**
+     * @returns whether a field for @p key is currently being generated.
+     */
+    bool isPending(const QString &key) const;
+
+    /**
+     * Schedule generating a field for @p key from @p source.
+     *
+     * @p source should be rasterized at ReferenceSize * Oversampling. Only
+     * its alpha channel is used. fieldReady() is emitted once the field can
+     * be retrieved with field().
+     */
+    void request(const QString &key, const QImage &source);
+
+    /**
+     * Generate a distance field from the alpha channel of @p source.
+     *
+     * @p spread and the padding around the field are expressed in pixels of
+     * the returned image, @p source is downsampled by @p oversampling.
+     */
+    static QImage generate(const QImage &source, int spread, int oversampling = 1);
+
+Q_SIGNALS:
+    void fieldReady(const QString &key);
+
+private:
+    friend class IconDistanceFieldSingleton;
+    IconDistanceField();
+
+    QCache<QString, QImage> m_fields;
+    QSet<QString> m_pending;
+};
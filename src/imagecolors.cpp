@@ -17,34 +17,196 @@
  */
 
 #include "imagecolors.h"
+#include "embeddedicons_p.h"
+#include "paletteindex.h"
 #include "platformtheme.h"
 
 #include <QDebug>
+#include <QOpenGLContext>
+#include <QOpenGLFramebufferObject>
+#include <QOpenGLFunctions>
+#include <QRunnable>
+#include <QSGDynamicTexture>
+#include <QSGRendererInterface>
+#include <QSGTextureProvider>
 #include <QTimer>
 #include <QtConcurrent>
 
 #include "loggingcategory.h"
 #include <cmath>
+#include <functional>
+#include <limits>
 
 #define return_fallback(value)                                                                                                                                 \
-    if (m_imageData.m_samples.size() == 0) {                                                                                                                   \
+    if (m_imageData.m_clusters.isEmpty()) {                                                                                                                    \
         return value;                                                                                                                                          \
     }
 
 #define return_fallback_finally(value, finally)                                                                                                                \
-    if (m_imageData.m_samples.size() == 0) {                                                                                                                   \
+    if (m_imageData.m_clusters.isEmpty()) {                                                                                                                    \
         return value.isValid() ? value : static_cast<Kirigami::PlatformTheme *>(qmlAttachedPropertiesObject<Kirigami::PlatformTheme>(this, true))->finally();  \
     }
 
+#ifndef GL_READ_FRAMEBUFFER
+#define GL_READ_FRAMEBUFFER 0x8CA8
+#endif
+#ifndef GL_DRAW_FRAMEBUFFER
+#define GL_DRAW_FRAMEBUFFER 0x8CA9
+#endif
+
+using BlitFramebufferFunction = void(QOPENGLF_APIENTRYP)(GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum);
+
+// glBlitFramebuffer is core since OpenGL 3.0 and OpenGL ES 3.0, older contexts
+// only have it through an extension, under another name.
+static BlitFramebufferFunction resolveBlitFramebuffer(QOpenGLContext *context)
+{
+    const char *name = nullptr;
+    if (context->format().majorVersion() >= 3) {
+        name = "glBlitFramebuffer";
+    } else if (context->hasExtension(QByteArrayLiteral("GL_EXT_framebuffer_blit"))) {
+        name = "glBlitFramebufferEXT";
+    } else if (context->hasExtension(QByteArrayLiteral("GL_ANGLE_framebuffer_blit"))) {
+        name = "glBlitFramebufferANGLE";
+    } else {
+        return nullptr;
+    }
+    return reinterpret_cast<BlitFramebufferFunction>(context->getProcAddress(name));
+}
+
+/**
+ * Render job that samples the texture of a texture provider item.
+ *
+ * The texture the item already has on the GPU is downscaled with a blit into a
+ * small framebuffer and only that is read back, instead of rendering the
+ * item again offscreen like grabToImage() does. This runs after the scene graph
+ * synchronized, so the GUI thread is blocked and the item can be accessed safely.
+ * A null image is delivered when the texture can't be sampled, for example
+ * because the item has not loaded its content yet or the context can't blit
+ * framebuffers, such as a plain OpenGL ES 2 one.
+ */
+class TextureSampleJob : public QRunnable
+{
+public:
+    TextureSampleJob(QQuickItem *item, const QSize &size, QObject *context, std::function<void(const QImage &)> callback)
+        : m_item(item)
+        , m_size(size)
+        , m_context(context)
+        , m_callback(callback)
+    {
+    }
+
+    void run() override
+    {
+        if (!m_context) {
+            return;
+        }
+
+        QImage image;
+        if (m_item) {
+            image = sample();
+        }
+
+        QMetaObject::invokeMethod(
+            m_context.data(),
+            [callback = m_callback, image]() {
+                callback(image);
+            },
+            Qt::QueuedConnection);
+    }
+
+private:
+    QImage sample()
+    {
+        auto context = QOpenGLContext::currentContext();
+        auto provider = m_item->textureProvider();
+        if (!context || !provider || !provider->texture()) {
+            return QImage();
+        }
+
+        QSGTexture *texture = provider->texture();
+        if (auto dynamicTexture = qobject_cast<QSGDynamicTexture *>(texture)) {
+            dynamicTexture->updateTexture();
+        }
+
+        const QSize textureSize = texture->textureSize();
+        if (textureSize.isEmpty() || texture->textureId() == 0) {
+            return QImage();
+        }
+
+        // Atlas textures only cover a part of the actual GL texture.
+        const QRectF subRect = texture->normalizedTextureSubRect();
+        const QSizeF fullSize(textureSize.width() / subRect.width(), textureSize.height() / subRect.height());
+        const QRect sourceRect(qRound(subRect.x() * fullSize.width()), //
+                               qRound(subRect.y() * fullSize.height()),
+                               textureSize.width(),
+                               textureSize.height());
+        const QSize targetSize = textureSize.scaled(m_size, Qt::KeepAspectRatio).expandedTo(QSize(1, 1));
+
+        const auto blitFramebuffer = resolveBlitFramebuffer(context);
+        if (!blitFramebuffer) {
+            return QImage();
+        }
+
+        auto gl = context->functions();
+
+        GLint previousFbo = 0;
+        gl->glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFbo);
+
+        // The scene graph may leave scissoring on, which would clip the blit
+        const bool scissorTest = gl->glIsEnabled(GL_SCISSOR_TEST);
+        if (scissorTest) {
+            gl->glDisable(GL_SCISSOR_TEST);
+        }
+
+        QOpenGLFramebufferObject target(targetSize);
+
+        GLuint sourceFbo = 0;
+        gl->glGenFramebuffers(1, &sourceFbo);
+        gl->glBindFramebuffer(GL_READ_FRAMEBUFFER, sourceFbo);
+        gl->glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture->textureId(), 0);
+
+        QImage image;
+        if (gl->glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE) {
+            gl->glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target.handle());
+            blitFramebuffer(sourceRect.left(),
+                            sourceRect.top(),
+                            sourceRect.right() + 1,
+                            sourceRect.bottom() + 1,
+                            0,
+                            0,
+                            targetSize.width(),
+                            targetSize.height(),
+                            GL_COLOR_BUFFER_BIT,
+                            GL_LINEAR);
+            // Textures may be stored upside down compared to the framebuffer,
+            // which doesn't matter for color extraction.
+            image = target.toImage();
+        }
+
+        gl->glBindFramebuffer(GL_FRAMEBUFFER, previousFbo);
+        gl->glDeleteFramebuffers(1, &sourceFbo);
+
+        if (scissorTest) {
+            gl->glEnable(GL_SCISSOR_TEST);
+        }
+
+        return image;
+    }
+
+    // Only accessed while the GUI thread is blocked for synchronization
+    QPointer<QQuickItem> m_item;
+    QSize m_size;
+    QPointer<QObject> m_context;
+    std::function<void(const QImage &)> m_callback;
+};
+
 ImageColors::ImageColors(QObject *parent)
     : QObject(parent)
 {
     m_imageSyncTimer = new QTimer(this);
     m_imageSyncTimer->setSingleShot(true);
     m_imageSyncTimer->setInterval(100);
-    /* connect(m_imageSyncTimer, &QTimer::timeout, this, [this]() {
-        generatePalette();
-     });*/
+    connect(m_imageSyncTimer, &QTimer::timeout, this, &ImageColors::update);
 }
 
 ImageColors::~ImageColors()
@@ -60,7 +222,7 @@ void ImageColors::setSource(const QVariant &source)
     } else if (source.canConvert<QIcon>()) {
         setSourceImage(source.value<QIcon>().pixmap(128, 128).toImage());
     } else if (source.canConvert<QString>()) {
-        setSourceImage(QIcon::fromTheme(source.toString()).pixmap(128, 128).toImage());
+        setSourceImage(Kirigami::EmbeddedIcons::fromTheme(source.toString()).pixmap(128, 128).toImage());
     } else {
         return;
     }
@@ -134,241 +296,300 @@ QQuickItem *ImageColors::sourceItem() const
     return m_sourceItem;
 }
 
-void ImageColors::update()
+QUrl ImageColors::paletteIndex() const
 {
-    if (m_futureImageData) {
-        m_futureImageData->cancel();
-        m_futureImageData->deleteLater();
-    }
-    auto runUpdate = [this]() {
-        QFuture<ImageData> future = QtConcurrent::run([this]() {
-            return generatePalette(m_sourceImage);
-        });
-        m_futureImageData = new QFutureWatcher<ImageData>(this);
-        connect(m_futureImageData, &QFutureWatcher<ImageData>::finished, this, [this]() {
-            if (!m_futureImageData) {
-                return;
-            }
-            m_imageData = m_futureImageData->future().result();
-            m_futureImageData->deleteLater();
-            m_futureImageData = nullptr;
-
-            Q_EMIT paletteChanged();
-        });
-        m_futureImageData->setFuture(future);
-    };
+    return m_paletteIndexUrl;
+}
 
-    if (!m_sourceItem || !m_window) {
-        if (!m_sourceImage.isNull()) {
-            runUpdate();
-        }
+void ImageColors::setPaletteIndex(const QUrl &url)
+{
+    if (url == m_paletteIndexUrl) {
         return;
     }
 
-    if (m_grabResult) {
-        disconnect(m_grabResult.data(), nullptr, this, nullptr);
-        m_grabResult.clear();
+    m_paletteIndexUrl = url;
+    m_paletteIndex.reset();
+    if (url.isLocalFile()) {
+        m_paletteIndex = PaletteIndex::open(url.toLocalFile());
+    } else if (url.scheme() == QLatin1String("qrc")) {
+        m_paletteIndex = PaletteIndex::open(QLatin1Char(':') + url.path());
+    } else if (!url.isEmpty()) {
+        qCWarning(KirigamiLog) << "Palette indexes can only be loaded from local files" << url;
     }
+    Q_EMIT paletteIndexChanged();
+}
 
-    m_grabResult = m_sourceItem->grabToImage(QSize(128, 128));
+qreal ImageColors::maximumUpdateRate() const
+{
+    return m_maximumUpdateRate;
+}
 
-    if (m_grabResult) {
-        connect(m_grabResult.data(), &QQuickItemGrabResult::ready, this, [this, runUpdate]() {
-            m_sourceImage = m_grabResult->image();
-            m_grabResult.clear();
-            runUpdate();
-        });
+void ImageColors::setMaximumUpdateRate(qreal rate)
+{
+    rate = std::max(rate, 0.0);
+    if (qFuzzyCompare(rate, m_maximumUpdateRate)) {
+        return;
     }
+
+    m_maximumUpdateRate = rate;
+    Q_EMIT maximumUpdateRateChanged();
 }
 
-inline int squareDistance(QRgb color1, QRgb color2)
+bool ImageColors::isIncremental() const
 {
-    // https://en.wikipedia.org/wiki/Color_difference
-    // Using RGB distance for performance, as CIEDE2000 istoo complicated
-    if (qRed(color1) - qRed(color2) < 128) {
-        return 2 * pow(qRed(color1) - qRed(color2), 2) //
-            + 4 * pow(qGreen(color1) - qGreen(color2), 2) //
-            + 3 * pow(qBlue(color1) - qBlue(color2), 2);
-    } else {
-        return 3 * pow(qRed(color1) - qRed(color2), 2) //
-            + 4 * pow(qGreen(color1) - qGreen(color2), 2) //
-            + 2 * pow(qBlue(color1) - qBlue(color2), 2);
+    return m_incremental;
+}
+
+void ImageColors::setIncremental(bool incremental)
+{
+    if (incremental == m_incremental) {
+        return;
     }
+
+    m_incremental = incremental;
+    Q_EMIT incrementalChanged();
 }
 
-void ImageColors::positionColor(QRgb rgb, QList<ImageData::colorStat> &clusters)
+int ImageColors::maximumIterations() const
 {
-    for (auto &stat : clusters) {
-        if (squareDistance(rgb, stat.centroid) < s_minimumSquareDistance) {
-            stat.colors.append(rgb);
-            return;
-        }
+    return m_maximumIterations;
+}
+
+void ImageColors::setMaximumIterations(int iterations)
+{
+    // At least one iteration is needed to compute the ratio of each cluster
+    iterations = std::max(iterations, 1);
+    if (iterations == m_maximumIterations) {
+        return;
     }
 
-    ImageData::colorStat stat;
-    stat.colors.append(rgb);
-    stat.centroid = rgb;
-    clusters << stat;
+    m_maximumIterations = iterations;
+    Q_EMIT maximumIterationsChanged();
 }
 
-ImageData ImageColors::generatePalette(const QImage &sourceImage)
+qreal ImageColors::smoothing() const
 {
-    ImageData imageData;
+    return m_smoothing;
+}
 
-    if (sourceImage.isNull() || sourceImage.width() == 0) {
-        return imageData;
+void ImageColors::setSmoothing(qreal smoothing)
+{
+    smoothing = qBound(0.0, smoothing, 0.99);
+    if (qFuzzyCompare(smoothing, m_smoothing)) {
+        return;
     }
 
-    imageData.m_clusters.clear();
-    imageData.m_samples.clear();
+    m_smoothing = smoothing;
+    Q_EMIT smoothingChanged();
+}
 
-    QColor sampleColor;
-    int r = 0;
-    int g = 0;
-    int b = 0;
-    int c = 0;
-    for (int x = 0; x < sourceImage.width(); ++x) {
-        for (int y = 0; y < sourceImage.height(); ++y) {
-            sampleColor = sourceImage.pixelColor(x, y);
-            if (sampleColor.alpha() == 0) {
-                continue;
+void ImageColors::update()
+{
+    if (m_maximumUpdateRate > 0.0 && m_lastUpdate.isValid()) {
+        const qint64 remaining = qint64(1000.0 / m_maximumUpdateRate) - m_lastUpdate.elapsed();
+        if (remaining > 0) {
+            // Coalesce all the updates until the interval expired
+            if (!m_imageSyncTimer->isActive()) {
+                m_imageSyncTimer->start(remaining);
             }
-            QRgb rgb = sampleColor.rgb();
-            c++;
-            r += qRed(rgb);
-            g += qGreen(rgb);
-            b += qBlue(rgb);
-            imageData.m_samples << rgb;
-            positionColor(rgb, imageData.m_clusters);
+            return;
         }
     }
+    m_imageSyncTimer->stop();
+    m_lastUpdate.start();
 
-    if (imageData.m_samples.isEmpty()) {
-        return imageData;
+    if (m_futureImageData) {
+        m_futureImageData->cancel();
+        m_futureImageData->deleteLater();
+        m_futureImageData = nullptr;
     }
 
-    imageData.m_average = QColor(r / c, g / c, b / c, 255);
+    if (lookupPaletteIndex()) {
+        return;
+    }
+    updateFromSource();
+}
 
-    for (int iteration = 0; iteration < 5; ++iteration) {
-        for (auto &stat : imageData.m_clusters) {
-            r = 0;
-            g = 0;
-            b = 0;
-            c = 0;
+bool ImageColors::lookupPaletteIndex()
+{
+    if (!m_paletteIndex || !m_sourceItem) {
+        return false;
+    }
 
-            for (auto color : std::as_const(stat.colors)) {
-                c++;
-                r += qRed(color);
-                g += qGreen(color);
-                b += qBlue(color);
-            }
-            r = r / c;
-            g = g / c;
-            b = b / c;
-            stat.centroid = qRgb(r, g, b);
-            stat.ratio = qreal(stat.colors.count()) / qreal(imageData.m_samples.count());
-            stat.colors = QList<QRgb>({stat.centroid});
+    // Only items loading a local file, such as Image, can be in the index
+    const QUrl url = m_sourceItem->property("source").toUrl();
+    if (!url.isLocalFile()) {
+        return false;
+    }
+    const QString path = url.toLocalFile();
+    if (!m_paletteIndex->contains(path)) {
+        return false;
+    }
+
+    // Hashing the file still needs to read it, so don't do it on the GUI thread
+    auto watcher = new QFutureWatcher<ImageData>(this);
+    m_futureImageData = watcher;
+    connect(watcher, &QFutureWatcher<ImageData>::finished, this, [this, watcher]() {
+        if (m_futureImageData != watcher) {
+            return;
         }
+        ImageData imageData = watcher->future().result();
+        watcher->deleteLater();
+        m_futureImageData = nullptr;
 
-        for (auto color : std::as_const(imageData.m_samples)) {
-            positionColor(color, imageData.m_clusters);
+        if (imageData.m_clusters.isEmpty()) {
+            // The file changed since the index has been generated
+            updateFromSource();
+            return;
         }
-    }
 
-    std::sort(imageData.m_clusters.begin(), imageData.m_clusters.end(), [](const ImageData::colorStat &a, const ImageData::colorStat &b) {
-        return a.colors.size() > b.colors.size();
+        smoothImageData(imageData);
+        m_imageData = imageData;
+        Q_EMIT paletteChanged();
     });
+    watcher->setFuture(QtConcurrent::run([index = m_paletteIndex, path]() {
+        ImageData imageData;
+        index->lookup(path, PaletteIndex::hashFile(path), imageData);
+        return imageData;
+    }));
+    return true;
+}
 
-    // compress blocks that became too similar
-    auto sourceIt = imageData.m_clusters.end();
-    QList<QList<ImageData::colorStat>::iterator> itemsToDelete;
-    while (sourceIt != imageData.m_clusters.begin()) {
-        sourceIt--;
-        for (auto destIt = imageData.m_clusters.begin(); destIt != imageData.m_clusters.end() && destIt != sourceIt; destIt++) {
-            if (squareDistance((*sourceIt).centroid, (*destIt).centroid) < s_minimumSquareDistance) {
-                const qreal ratio = (*sourceIt).ratio / (*destIt).ratio;
-                const int r = ratio * qreal(qRed((*sourceIt).centroid)) + (1 - ratio) * qreal(qRed((*destIt).centroid));
-                const int g = ratio * qreal(qGreen((*sourceIt).centroid)) + (1 - ratio) * qreal(qGreen((*destIt).centroid));
-                const int b = ratio * qreal(qBlue((*sourceIt).centroid)) + (1 - ratio) * qreal(qBlue((*destIt).centroid));
-                (*destIt).ratio += (*sourceIt).ratio;
-                (*destIt).centroid = qRgb(r, g, b);
-                itemsToDelete << sourceIt;
-                break;
+void ImageColors::updateFromSource()
+{
+    auto runUpdate = [this]() {
+        QList<QRgb> seeds;
+        if (m_incremental) {
+            for (const auto &stat : std::as_const(m_imageData.m_clusters)) {
+                seeds << stat.centroid;
             }
         }
-    }
-    for (const auto &i : std::as_const(itemsToDelete)) {
-        imageData.m_clusters.erase(i);
-    }
+        QFuture<ImageData> future = QtConcurrent::run([image = m_sourceImage, seeds, iterations = m_maximumIterations]() {
+            // Large images such as wallpapers and photos are split up so all cores work on them
+            if (qint64(image.width()) * image.height() >= PaletteGenerator::s_tiledMinimumPixels && QThread::idealThreadCount() > 1) {
+                return PaletteGenerator::generatePaletteTiled(image, seeds, iterations);
+            }
+            return PaletteGenerator::generatePalette(image, seeds, iterations);
+        });
+        auto watcher = new QFutureWatcher<ImageData>(this);
+        m_futureImageData = watcher;
+        connect(watcher, &QFutureWatcher<ImageData>::finished, this, [this, watcher]() {
+            if (m_futureImageData != watcher) {
+                return;
+            }
+            ImageData imageData = watcher->future().result();
+            smoothImageData(imageData);
+            m_imageData = imageData;
+            watcher->deleteLater();
+            m_futureImageData = nullptr;
 
-    imageData.m_highlight = QColor();
-    imageData.m_dominant = QColor(imageData.m_clusters.first().centroid);
-    imageData.m_closestToBlack = Qt::white;
-    imageData.m_closestToWhite = Qt::black;
+            Q_EMIT paletteChanged();
+        });
+        watcher->setFuture(future);
+    };
 
-    imageData.m_palette.clear();
+    if (!m_sourceItem || !m_window) {
+        if (!m_sourceImage.isNull()) {
+            runUpdate();
+        }
+        return;
+    }
 
-    bool first = true;
+    if (m_grabResult) {
+        disconnect(m_grabResult.data(), nullptr, this, nullptr);
+        m_grabResult.clear();
+    }
 
-    for (const auto &stat : std::as_const(imageData.m_clusters)) {
-        QVariantMap entry;
-        const QColor color(stat.centroid);
-        entry[QStringLiteral("color")] = color;
-        entry[QStringLiteral("ratio")] = stat.ratio;
+    auto grab = [this, runUpdate]() {
+        if (!m_sourceItem) {
+            return;
+        }
 
-        QColor contrast = QColor(255 - color.red(), 255 - color.green(), 255 - color.blue());
-        contrast.setHsl(contrast.hslHue(), //
-                        contrast.hslSaturation(), //
-                        128 + (128 - contrast.lightness()));
-        QColor tempContrast;
-        int minimumDistance = 4681800; // max distance: 4*3*2*3*255*255
-        for (const auto &stat : std::as_const(imageData.m_clusters)) {
-            const int distance = squareDistance(contrast.rgb(), stat.centroid);
+        m_grabResult = m_sourceItem->grabToImage(QSize(128, 128));
 
-            if (distance < minimumDistance) {
-                tempContrast = QColor(stat.centroid);
-                minimumDistance = distance;
-            }
+        if (m_grabResult) {
+            connect(m_grabResult.data(), &QQuickItemGrabResult::ready, this, [this, runUpdate]() {
+                m_sourceImage = m_grabResult->image();
+                m_grabResult.clear();
+                runUpdate();
+            });
         }
+    };
 
-        if (imageData.m_clusters.size() <= 3) {
-            if (qGray(imageData.m_dominant.rgb()) < 120) {
-                contrast = QColor(230, 230, 230);
-            } else {
-                contrast = QColor(20, 20, 20);
+    // Items such as Image already have their content in a texture, so sample
+    // that on the render thread rather than rendering the item again. Contexts
+    // that can't blit it get a null image and fall back to grabbing.
+    if (m_sourceItem->isTextureProvider() && m_window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL) {
+        QPointer<QQuickItem> item = m_sourceItem;
+        auto job = new TextureSampleJob(m_sourceItem, QSize(128, 128), this, [this, item, runUpdate, grab](const QImage &image) {
+            if (!item || item != m_sourceItem) {
+                return;
             }
-            // TODO: replace m_clusters.size() > 3 with entropy calculation
-        } else if (squareDistance(contrast.rgb(), tempContrast.rgb()) < s_minimumSquareDistance * 1.5) {
-            contrast = tempContrast;
-        } else {
-            contrast = tempContrast;
-            contrast.setHsl(contrast.hslHue(),
-                            contrast.hslSaturation(),
-                            contrast.lightness() > 128 ? qMin(contrast.lightness() + 20, 255) : qMax(0, contrast.lightness() - 20));
-        }
+            if (image.isNull()) {
+                grab();
+                return;
+            }
+            m_sourceImage = image;
+            runUpdate();
+        });
+        m_window->scheduleRenderJob(job, QQuickWindow::AfterSynchronizingStage);
+        m_window->update();
+        return;
+    }
 
-        entry[QStringLiteral("contrastColor")] = contrast;
+    grab();
+}
 
-        if (first) {
-            imageData.m_dominantContrast = contrast;
-            imageData.m_dominant = color;
-        }
-        first = false;
+static QColor smoothColor(const QColor &previous, const QColor &next, qreal smoothing)
+{
+    if (!previous.isValid()) {
+        return next;
+    }
+    return QColor::fromRgbF(previous.redF() * smoothing + next.redF() * (1 - smoothing),
+                            previous.greenF() * smoothing + next.greenF() * (1 - smoothing),
+                            previous.blueF() * smoothing + next.blueF() * (1 - smoothing),
+                            previous.alphaF() * smoothing + next.alphaF() * (1 - smoothing));
+}
 
-        if (!imageData.m_highlight.isValid() || ColorUtils::chroma(color) > ColorUtils::chroma(imageData.m_highlight)) {
-            imageData.m_highlight = color;
-        }
+void ImageColors::smoothImageData(ImageData &imageData) const
+{
+    if (qFuzzyIsNull(m_smoothing) || m_imageData.m_clusters.isEmpty() || imageData.m_clusters.isEmpty()) {
+        return;
+    }
 
-        if (qGray(color.rgb()) > qGray(imageData.m_closestToWhite.rgb())) {
-            imageData.m_closestToWhite = color;
+    imageData.m_average = smoothColor(m_imageData.m_average, imageData.m_average, m_smoothing);
+    imageData.m_dominant = smoothColor(m_imageData.m_dominant, imageData.m_dominant, m_smoothing);
+    imageData.m_dominantContrast = smoothColor(m_imageData.m_dominantContrast, imageData.m_dominantContrast, m_smoothing);
+    imageData.m_highlight = smoothColor(m_imageData.m_highlight, imageData.m_highlight, m_smoothing);
+    imageData.m_closestToBlack = smoothColor(m_imageData.m_closestToBlack, imageData.m_closestToBlack, m_smoothing);
+    imageData.m_closestToWhite = smoothColor(m_imageData.m_closestToWhite, imageData.m_closestToWhite, m_smoothing);
+
+    // Palette entries move towards the closest entry of the previous palette
+    for (auto &entry : imageData.m_palette) {
+        auto map = entry.toMap();
+        const QColor color = map.value(QStringLiteral("color")).value<QColor>();
+
+        QVariantMap closest;
+        int minimumDistance = std::numeric_limits<int>::max();
+        for (const auto &previousEntry : std::as_const(m_imageData.m_palette)) {
+            const auto previousMap = previousEntry.toMap();
+            const int distance = PaletteGenerator::squareDistance(color.rgb(), previousMap.value(QStringLiteral("color")).value<QColor>().rgb());
+            if (distance < minimumDistance) {
+                closest = previousMap;
+                minimumDistance = distance;
+            }
         }
-        if (qGray(color.rgb()) < qGray(imageData.m_closestToBlack.rgb())) {
-            imageData.m_closestToBlack = color;
+        if (closest.isEmpty()) {
+            continue;
         }
-        imageData.m_palette << entry;
-    }
 
-    return imageData;
+        map[QStringLiteral("color")] = smoothColor(closest.value(QStringLiteral("color")).value<QColor>(), color, m_smoothing);
+        map[QStringLiteral("contrastColor")] = smoothColor(closest.value(QStringLiteral("contrastColor")).value<QColor>(),
+                                                           map.value(QStringLiteral("contrastColor")).value<QColor>(),
+                                                           m_smoothing);
+        map[QStringLiteral("ratio")] = closest.value(QStringLiteral("ratio")).toReal() * m_smoothing + map.value(QStringLiteral("ratio")).toReal() * (1 - m_smoothing);
+        entry = map;
+    }
 }
 
 QVariantList ImageColors::palette() const
@@ -19,8 +19,10 @@
 #pragma once
 
 #include "colorutils.h"
+#include "palettegenerator.h"
 
 #include <QColor>
+#include <QElapsedTimer>
 #include <QFuture>
 #include <QImage>
 #include <QObject>
@@ -29,35 +31,10 @@
 #include <QQuickItemGrabResult>
 #include <QQuickWindow>
 
-class QTimer;
+#include <memory>
 
-struct ImageData {
-    struct colorStat {
-        QList<QRgb> colors;
-        QRgb centroid = 0;
-        qreal ratio = 0;
-    };
-
-    struct colorSet {
-        QColor average;
-        QColor text;
-        QColor background;
-        QColor highlight;
-    };
-
-    QList<QRgb> m_samples;
-    QList<colorStat> m_clusters;
-    QVariantList m_palette;
-
-    bool m_darkPalette = true;
-    QColor m_dominant;
-    QColor m_dominantContrast;
-    QColor m_average;
-    QColor m_highlight;
-
-    QColor m_closestToBlack;
-    QColor m_closestToWhite;
-};
+class PaletteIndex;
+class QTimer;
 
 class ImageColors : public QObject
 {
@@ -72,6 +49,10 @@ class ImageColors : public QObject
      * * Icon name
      *
      * Note that an Item's color palette will only be extracted once unless you * call `update()`, regardless of how the item hanges.
+     *
+     * Items that are texture providers, such as Image, are sampled directly
+     * from their texture on the render thread when using OpenGL, other items
+     * are rendered offscreen with QQuickItem::grabToImage().
      */
     Q_PROPERTY(QVariant source READ source WRITE setSource NOTIFY sourceChanged)
 
@@ -209,6 +190,62 @@ class ImageColors : public QObject
      */
     Q_PROPERTY(QColor fallbackBackground MEMBER m_fallbackBackground NOTIFY fallbackBackgroundChanged)
 
+    /**
+     * A palette index generated by kirigami-palette-indexer.
+     *
+     * When the source is an item showing a local file, such as an Image, and
+     * the index has an up to date entry for that file, the palette is taken
+     * from the index instead of being computed.
+     *
+     * @since 5.88
+     */
+    Q_PROPERTY(QUrl paletteIndex READ paletteIndex WRITE setPaletteIndex NOTIFY paletteIndexChanged)
+
+    /**
+     * The maximum number of times per second the palette gets computed.
+     *
+     * Calls to update() happening more often than that are coalesced into a
+     * single update, which keeps the work bounded when the source is a video
+     * or an animated item.
+     * The default is 0, which means there is no limit.
+     *
+     * @since 5.88
+     */
+    Q_PROPERTY(qreal maximumUpdateRate READ maximumUpdateRate WRITE setMaximumUpdateRate NOTIFY maximumUpdateRateChanged)
+
+    /**
+     * Whether a new palette is refined from the clusters of the previous one.
+     *
+     * Consecutive frames of a video or an animation are usually similar, so
+     * starting from the previous centroids converges in fewer iterations and
+     * keeps the palette stable. Use it together with maximumIterations.
+     * The default is false.
+     *
+     * @since 5.88
+     */
+    Q_PROPERTY(bool incremental READ isIncremental WRITE setIncremental NOTIFY incrementalChanged)
+
+    /**
+     * The maximum amount of clustering iterations done for each update.
+     *
+     * The default is 5.
+     *
+     * @since 5.88
+     */
+    Q_PROPERTY(int maximumIterations READ maximumIterations WRITE setMaximumIterations NOTIFY maximumIterationsChanged)
+
+    /**
+     * How much of the previous palette is kept when a new one is computed.
+     *
+     * Values between 0 and 1: with 0 the new colors replace the old ones,
+     * higher values make the colors move towards the new palette
+     * progressively over several updates.
+     * The default is 0.
+     *
+     * @since 5.88
+     */
+    Q_PROPERTY(qreal smoothing READ smoothing WRITE setSmoothing NOTIFY smoothingChanged)
+
 public:
     explicit ImageColors(QObject *parent = nullptr);
     ~ImageColors() override;
@@ -224,6 +261,21 @@ public:
 
     Q_INVOKABLE void update();
 
+    QUrl paletteIndex() const;
+    void setPaletteIndex(const QUrl &url);
+
+    qreal maximumUpdateRate() const;
+    void setMaximumUpdateRate(qreal rate);
+
+    bool isIncremental() const;
+    void setIncremental(bool incremental);
+
+    int maximumIterations() const;
+    void setMaximumIterations(int iterations);
+
+    qreal smoothing() const;
+    void setSmoothing(qreal smoothing);
+
     QVariantList palette() const;
     ColorUtils::Brightness paletteBrightness() const;
     QColor average() const;
@@ -246,13 +298,17 @@ Q_SIGNALS:
     void fallbackHighlightChanged();
     void fallbackForegroundChanged();
     void fallbackBackgroundChanged();
+    void paletteIndexChanged();
+    void maximumUpdateRateChanged();
+    void incrementalChanged();
+    void maximumIterationsChanged();
+    void smoothingChanged();
 
 private:
-    static inline void positionColor(QRgb rgb, QList<ImageData::colorStat> &clusters);
-    static ImageData generatePalette(const QImage &sourceImage);
+    bool lookupPaletteIndex();
+    void updateFromSource();
+    void smoothImageData(ImageData &imageData) const;
 
-    // Arbitrary number that seems to work well
-    static const int s_minimumSquareDistance = 32000;
     QPointer<QQuickWindow> m_window;
     QVariant m_source;
     QPointer<QQuickItem> m_sourceItem;
@@ -260,6 +316,15 @@ private:
     QImage m_sourceImage;
 
     QTimer *m_imageSyncTimer;
+    QElapsedTimer m_lastUpdate;
+
+    QUrl m_paletteIndexUrl;
+    std::shared_ptr<PaletteIndex> m_paletteIndex;
+
+    qreal m_maximumUpdateRate = 0.0;
+    bool m_incremental = false;
+    int m_maximumIterations = 5;
+    qreal m_smoothing = 0.0;
 
     QFutureWatcher<ImageData> *m_futureImageData = nullptr;
     ImageData m_imageData;
@@ -7,17 +7,24 @@
  */
 
 #include "kirigamiplugin.h"
+#include "actiontreemodel.h"
 #include "avatar.h"
 #include "colorutils.h"
 #include "columnview.h"
 #include "delegaterecycler.h"
+#include "drawerhandleicon.h"
 #include "enums.h"
 #include "formlayoutattached.h"
+#include "herotransition.h"
 #include "icon.h"
 #include "imagecolors.h"
 #include "mnemonicattached.h"
+#include "navigationtablayout.h"
+#include "overlaysheetlayout.h"
+#include "pageactioncollector.h"
 #include "pagepool.h"
 #include "pagerouter.h"
+#include "passivenotificationmodel.h"
 #include "scenepositionattached.h"
 #include "settings.h"
 #include "shadowedrectangle.h"
@@ -35,6 +42,7 @@
 #include <QQuickStyle>
 
 #include "libkirigami/basictheme_p.h"
+#include "libkirigami/embeddedicons_p.h"
 #include "libkirigami/platformtheme.h"
 #include "libkirigami/styleselector_p.h"
 #include "loggingcategory.h"
@@ -114,6 +122,7 @@ void KirigamiPlugin::registerTypes(const char *uri)
     if (QIcon::themeName().isEmpty() && !qEnvironmentVariableIsSet("XDG_CURRENT_DESKTOP")) {
         QIcon::setThemeSearchPaths({Kirigami::StyleSelector::resolveFilePath(QStringLiteral(".")), QStringLiteral(":/icons")});
         QIcon::setThemeName(QStringLiteral("breeze-internal"));
+        Kirigami::EmbeddedIcons::load(QStringLiteral(":/icons/breeze-internal.index"));
     }
 
     qmlRegisterSingletonType<Settings>(uri, 2, 0, "Settings", [](QQmlEngine *e, QJSEngine *) -> QObject * {
@@ -313,6 +322,14 @@ void KirigamiPlugin::registerTypes(const char *uri)
     // 2.19
     qmlRegisterType(componentUrl(QStringLiteral("NavigationTabBar.qml")), uri, 2, 19, "NavigationTabBar");
     qmlRegisterType(componentUrl(QStringLiteral("NavigationTabButton.qml")), uri, 2, 19, "NavigationTabButton");
+    qmlRegisterType(componentUrl(QStringLiteral("swipenavigator/LazyPage.qml")), uri, 2, 19, "LazyPage");
+    qmlRegisterType<ActionTreeModel>("org.kde.kirigami.private", 2, 19, "ActionTreeModel");
+    qmlRegisterType<DrawerHandleIcon>("org.kde.kirigami.private", 2, 19, "DrawerHandleIcon");
+    qmlRegisterType<HeroTransition>("org.kde.kirigami.private", 2, 19, "HeroTransition");
+    qmlRegisterType<PassiveNotificationModel>("org.kde.kirigami.private", 2, 19, "PassiveNotificationModel");
+    qmlRegisterType<NavigationTabLayout>("org.kde.kirigami.private", 2, 19, "NavigationTabLayout");
+    qmlRegisterType<OverlaySheetLayout>("org.kde.kirigami.private", 2, 19, "OverlaySheetLayout");
+    qmlRegisterType<PageActionCollector>("org.kde.kirigami.private", 2, 19, "PageActionCollector");
 
     qmlProtectModule(uri, 2);
 }
@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "embeddedicons_p.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QSize>
+#include <QVector>
+
+namespace Kirigami
+{
+struct IconFile {
+    QString path;
+    int size = 0;
+};
+
+struct EmbeddedIconIndex {
+    QMutex mutex;
+    bool loaded = false;
+    QHash<QString, QVector<IconFile>> files;
+    // Icons of the index are only created the first time they are asked for.
+    // Names missing from the index are not cached, so this never grows beyond
+    // the size of the index.
+    QHash<QString, QIcon> icons;
+};
+
+Q_GLOBAL_STATIC(EmbeddedIconIndex, s_index)
+
+bool EmbeddedIcons::load(const QString &indexPath)
+{
+    QFile file(indexPath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const QString directory = QFileInfo(indexPath).path() + QLatin1Char('/');
+
+    QMutexLocker locker(&s_index->mutex);
+    s_index->files.clear();
+    s_index->icons.clear();
+
+    // One line per icon file: name, nominal size and path relative to the
+    // index, separated by tabs.
+    while (!file.atEnd()) {
+        const QString line = QString::fromUtf8(file.readLine()).trimmed();
+        if (line.isEmpty() || line.startsWith(QLatin1Char('#'))) {
+            continue;
+        }
+
+        const auto fields = line.splitRef(QLatin1Char('\t'));
+        if (fields.size() != 3) {
+            continue;
+        }
+
+        s_index->files[fields[0].toString()].append({directory + fields[2].toString(), fields[1].toInt()});
+    }
+
+    s_index->loaded = true;
+    return true;
+}
+
+bool EmbeddedIcons::isLoaded()
+{
+    QMutexLocker locker(&s_index->mutex);
+    return s_index->loaded;
+}
+
+QIcon EmbeddedIcons::fromTheme(const QString &name)
+{
+    // The index only describes breeze-internal, the application may have
+    // switched to another theme since it was loaded.
+    if (QIcon::themeName() == QLatin1String("breeze-internal")) {
+        QMutexLocker locker(&s_index->mutex);
+
+        auto cached = s_index->icons.constFind(name);
+        if (cached != s_index->icons.constEnd()) {
+            return cached.value();
+        }
+
+        auto itr = s_index->files.constFind(name);
+        if (itr != s_index->files.constEnd()) {
+            QIcon icon;
+            for (const auto &file : itr.value()) {
+                icon.addFile(file.path, file.size > 0 ? QSize(file.size, file.size) : QSize());
+            }
+            s_index->icons.insert(name, icon);
+            return icon;
+        }
+    }
+
+    return QIcon::fromTheme(name);
+}
+
+}
@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef EMBEDDEDICONS_H
+#define EMBEDDEDICONS_H
+
+#include <QIcon>
+#include <QString>
+
+#include <kirigami2_export.h>
+
+namespace Kirigami
+{
+/**
+ * Lookup of icons in the embedded "breeze-internal" icon theme.
+ *
+ * The theme is compiled into the application from kirigami-icons.qrc, which
+ * scripts/gen_icons_qrc.sh generates together with an index mapping icon
+ * names to their files and sizes. Once the index is loaded, and as long as
+ * "breeze-internal" is the current icon theme, resolving an icon of the index
+ * is a hash lookup instead of a search through the theme directories, and
+ * only the files of icons that are actually used are ever read.
+ *
+ * All functions are thread-safe.
+ */
+class KIRIGAMI2_EXPORT EmbeddedIcons
+{
+public:
+    /**
+     * Load the index at @p indexPath. Returns false if there is no index, in
+     * which case lookups keep going through QIcon::fromTheme().
+     */
+    static bool load(const QString &indexPath);
+    static bool isLoaded();
+
+    /**
+     * The icon called @p name from the embedded theme. Names which are not in
+     * the index, such as application icons or icons from custom search paths,
+     * are looked up with QIcon::fromTheme(), as is every name when no index is
+     * loaded or the current theme is not "breeze-internal".
+     */
+    static QIcon fromTheme(const QString &name);
+};
+
+}
+
+#endif // EMBEDDEDICONS_H
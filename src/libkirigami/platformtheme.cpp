@@ -7,6 +7,7 @@
 
 #include "platformtheme.h"
 #include "basictheme_p.h"
+#include "embeddedicons_p.h"
 #include "kirigamipluginfactory.h"
 #include <QDebug>
 #include <QDir>
@@ -822,7 +823,7 @@ void PlatformTheme::setPalette(const QPalette &palette)
 QIcon PlatformTheme::iconFromTheme(const QString &name, const QColor &customColor)
 {
     Q_UNUSED(customColor);
-    QIcon icon = QIcon::fromTheme(name);
+    QIcon icon = EmbeddedIcons::fromTheme(name);
     return icon;
 }
 
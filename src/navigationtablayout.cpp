@@ -0,0 +1,539 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "navigationtablayout.h"
+
+#include <cmath>
+
+#include <QHash>
+#include <QMetaMethod>
+#include <QQmlComponent>
+#include <QQmlContext>
+#include <QQmlEngine>
+#include <QSet>
+#include <QVector>
+
+#include "loggingcategory.h"
+
+class NavigationTabLayout::Private
+{
+public:
+    Private(NavigationTabLayout *qq)
+        : q(qq)
+    {
+    }
+
+    void syncTabs();
+    QQuickItem *createTab(QObject *action);
+    void assignAction(QQuickItem *tab, QObject *action);
+    void setTabs(const QList<QQuickItem *> &newTabs);
+    void performLayout();
+    void updateCurrentIndex();
+    void applyRequestedIndex();
+    void releaseDelegateTabs();
+
+    NavigationTabLayout *q;
+
+    QVector<QObject *> actions;
+    ActionsProperty actionsProperty;
+    QQmlComponent *delegate = nullptr;
+    qreal spacing = 0.0;
+    qreal tabWidth = 0.0;
+
+    // Tabs created from the delegate, either showing an action or spare.
+    QHash<QObject *, QQuickItem *> actionTabs;
+    QVector<QQuickItem *> spareTabs;
+    QSet<QQuickItem *> delegateTabs;
+
+    QList<QQuickItem *> tabs;
+    int currentIndex = -1;
+    int requestedIndex = -1;
+    bool hasRequestedIndex = false;
+
+    bool completed = false;
+    bool tabsDirty = true;
+    bool actionsChanged = false;
+    bool updatingChecked = false;
+
+    static void appendAction(ActionsProperty *list, QObject *action);
+    static int actionCount(ActionsProperty *list);
+    static QObject *action(ActionsProperty *list, int index);
+    static void clearActions(ActionsProperty *list);
+};
+
+static bool isButton(QQuickItem *item)
+{
+    // Any AbstractButton can act as a tab.
+    return item->inherits("QQuickAbstractButton");
+}
+
+NavigationTabLayout::NavigationTabLayout(QQuickItem *parent)
+    : QQuickItem(parent)
+    , d(std::make_unique<Private>(this))
+{
+    d->actionsProperty = ActionsProperty(this, this, Private::appendAction, Private::actionCount, Private::action, Private::clearActions);
+}
+
+NavigationTabLayout::~NavigationTabLayout()
+{
+    // Tabs are children of this item and get destroyed along with it, make
+    // sure their changes no longer reach us while that happens.
+    for (auto tab : std::as_const(d->tabs)) {
+        disconnect(tab, nullptr, this, nullptr);
+    }
+}
+
+NavigationTabLayout::ActionsProperty NavigationTabLayout::actionsProperty() const
+{
+    return d->actionsProperty;
+}
+
+void NavigationTabLayout::addAction(QObject *action)
+{
+    d->actions.append(action);
+    d->actionsChanged = true;
+    d->tabsDirty = true;
+
+    connect(action, &QObject::destroyed, this, [this](QObject *action) {
+        d->actions.removeAll(action);
+        if (auto tab = d->actionTabs.take(action)) {
+            d->spareTabs.append(tab);
+        }
+        d->actionsChanged = true;
+        d->tabsDirty = true;
+        relayout();
+    });
+
+    relayout();
+}
+
+void NavigationTabLayout::clearActions()
+{
+    for (auto action : std::as_const(d->actions)) {
+        disconnect(action, &QObject::destroyed, this, nullptr);
+    }
+
+    // Tabs stay around in actionTabs until the next sync, so an action that
+    // is part of the new list keeps its tab.
+    d->actions.clear();
+    d->actionsChanged = true;
+    d->tabsDirty = true;
+    relayout();
+}
+
+QQmlComponent *NavigationTabLayout::delegate() const
+{
+    return d->delegate;
+}
+
+void NavigationTabLayout::setDelegate(QQmlComponent *newDelegate)
+{
+    if (newDelegate == d->delegate) {
+        return;
+    }
+
+    d->delegate = newDelegate;
+    d->releaseDelegateTabs();
+    d->tabsDirty = true;
+    relayout();
+    Q_EMIT delegateChanged();
+}
+
+qreal NavigationTabLayout::spacing() const
+{
+    return d->spacing;
+}
+
+void NavigationTabLayout::setSpacing(qreal newSpacing)
+{
+    if (newSpacing == d->spacing) {
+        return;
+    }
+
+    d->spacing = newSpacing;
+    relayout();
+    Q_EMIT spacingChanged();
+}
+
+qreal NavigationTabLayout::tabWidth() const
+{
+    return d->tabWidth;
+}
+
+QList<QQuickItem *> NavigationTabLayout::tabs() const
+{
+    return d->tabs;
+}
+
+int NavigationTabLayout::count() const
+{
+    return d->tabs.size();
+}
+
+int NavigationTabLayout::currentIndex() const
+{
+    return d->currentIndex;
+}
+
+void NavigationTabLayout::setCurrentIndex(int newCurrentIndex)
+{
+    d->requestedIndex = newCurrentIndex;
+    d->hasRequestedIndex = true;
+
+    // Before completion the tabs may not all exist yet, the request is then
+    // applied once they do.
+    if (d->completed) {
+        if (d->tabsDirty) {
+            d->syncTabs();
+        }
+        d->applyRequestedIndex();
+    }
+}
+
+void NavigationTabLayout::relayout()
+{
+    if (d->completed) {
+        polish();
+    }
+}
+
+void NavigationTabLayout::componentComplete()
+{
+    QQuickItem::componentComplete();
+    d->completed = true;
+
+    // Create the tabs right away, so count and currentIndex are correct as
+    // soon as the tab bar is.
+    d->syncTabs();
+    d->applyRequestedIndex();
+    relayout();
+}
+
+void NavigationTabLayout::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    if (newGeometry.size() != oldGeometry.size()) {
+        relayout();
+    }
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+}
+
+void NavigationTabLayout::itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &data)
+{
+    if (change == ItemChildAddedChange || change == ItemChildRemovedChange) {
+        if (change == ItemChildRemovedChange) {
+            d->spareTabs.removeOne(data.item);
+            d->delegateTabs.remove(data.item);
+            for (auto itr = d->actionTabs.begin(); itr != d->actionTabs.end();) {
+                itr = itr.value() == data.item ? d->actionTabs.erase(itr) : std::next(itr);
+            }
+        }
+        d->tabsDirty = true;
+        relayout();
+    } else if (change == ItemVisibleHasChanged || change == ItemSceneChange) {
+        relayout();
+    }
+    QQuickItem::itemChange(change, data);
+}
+
+void NavigationTabLayout::updatePolish()
+{
+    if (d->tabsDirty) {
+        d->syncTabs();
+    }
+    d->applyRequestedIndex();
+    d->performLayout();
+
+    if (d->actionsChanged) {
+        // Assigning a list appends every action separately, only notify once
+        // everything has been processed.
+        d->actionsChanged = false;
+        Q_EMIT actionsChanged();
+    }
+}
+
+void NavigationTabLayout::onTabCheckedChanged()
+{
+    auto tab = qobject_cast<QQuickItem *>(sender());
+    if (!tab || d->updatingChecked) {
+        return;
+    }
+
+    if (tab->property("checked").toBool()) {
+        // Only one tab is checked at a time, regardless of which button group
+        // the tabs belong to.
+        d->updatingChecked = true;
+        for (auto other : std::as_const(d->tabs)) {
+            if (other != tab && other->property("checked").toBool()) {
+                other->setProperty("checked", false);
+            }
+        }
+        d->updatingChecked = false;
+    }
+
+    d->updateCurrentIndex();
+}
+
+void NavigationTabLayout::Private::syncTabs()
+{
+    tabsDirty = false;
+
+    if (delegate) {
+        QHash<QObject *, QQuickItem *> usedTabs;
+        QVector<QObject *> newActions;
+        for (auto action : std::as_const(actions)) {
+            if (usedTabs.contains(action)) {
+                continue;
+            }
+            if (auto tab = actionTabs.take(action)) {
+                usedTabs.insert(action, tab);
+            } else {
+                newActions.append(action);
+            }
+        }
+
+        // Anything left belongs to actions that are gone, keep those tabs
+        // around for the actions that are new.
+        for (auto tab : std::as_const(actionTabs)) {
+            assignAction(tab, nullptr);
+            spareTabs.append(tab);
+        }
+        actionTabs = usedTabs;
+
+        for (auto action : std::as_const(newActions)) {
+            QQuickItem *tab = nullptr;
+            if (!spareTabs.isEmpty()) {
+                tab = spareTabs.takeLast();
+                assignAction(tab, action);
+            } else {
+                tab = createTab(action);
+            }
+            if (tab) {
+                actionTabs.insert(action, tab);
+            }
+        }
+    }
+
+    // Buttons added as children come first, followed by the tabs for actions.
+    QList<QQuickItem *> newTabs;
+    const auto children = q->childItems();
+    for (auto child : children) {
+        if (!delegateTabs.contains(child) && isButton(child)) {
+            newTabs.append(child);
+        }
+    }
+    for (auto action : std::as_const(actions)) {
+        auto tab = actionTabs.value(action);
+        if (tab && !newTabs.contains(tab)) {
+            newTabs.append(tab);
+        }
+    }
+
+    setTabs(newTabs);
+}
+
+QQuickItem *NavigationTabLayout::Private::createTab(QObject *action)
+{
+    auto context = delegate->creationContext();
+    if (!context) {
+        context = qmlContext(q);
+    }
+
+    auto object = delegate->beginCreate(context);
+    auto tab = qobject_cast<QQuickItem *>(object);
+    if (!tab) {
+        qCWarning(KirigamiLog) << "NavigationTabLayout: delegate does not create an item" << delegate->errorString();
+        if (object) {
+            delegate->completeCreate();
+            object->deleteLater();
+        }
+        return nullptr;
+    }
+
+    delegateTabs.insert(tab);
+    QQmlEngine::setObjectOwnership(tab, QQmlEngine::CppOwnership);
+    tab->setParentItem(q);
+    assignAction(tab, action);
+    delegate->completeCreate();
+
+    return tab;
+}
+
+void NavigationTabLayout::Private::assignAction(QQuickItem *tab, QObject *action)
+{
+    if (action) {
+        // Tabs can only be checked if their action is checkable.
+        action->setProperty("checkable", true);
+    }
+    tab->setProperty("action", QVariant::fromValue(action));
+}
+
+void NavigationTabLayout::Private::setTabs(const QList<QQuickItem *> &newTabs)
+{
+    if (newTabs == tabs) {
+        return;
+    }
+
+    static const QMetaMethod checkedSlot = staticMetaObject.method(staticMetaObject.indexOfMethod("onTabCheckedChanged()"));
+
+    for (auto tab : std::as_const(tabs)) {
+        if (!newTabs.contains(tab)) {
+            QObject::disconnect(tab, nullptr, q, nullptr);
+        }
+    }
+
+    for (auto tab : newTabs) {
+        if (tabs.contains(tab)) {
+            continue;
+        }
+
+        const auto metaObject = tab->metaObject();
+        const int checkedIndex = metaObject->indexOfProperty("checked");
+        if (checkedIndex >= 0 && metaObject->property(checkedIndex).hasNotifySignal()) {
+            QObject::connect(tab, metaObject->property(checkedIndex).notifySignal(), q, checkedSlot);
+        }
+
+        QObject::connect(tab, &QQuickItem::visibleChanged, q, &NavigationTabLayout::relayout);
+        QObject::connect(tab, &QQuickItem::implicitWidthChanged, q, &NavigationTabLayout::relayout);
+        QObject::connect(tab, &QQuickItem::implicitHeightChanged, q, &NavigationTabLayout::relayout);
+        QObject::connect(tab, &QQuickItem::widthChanged, q, &NavigationTabLayout::relayout);
+        QObject::connect(tab, &QQuickItem::heightChanged, q, &NavigationTabLayout::relayout);
+    }
+
+    tabs = newTabs;
+    Q_EMIT q->tabsChanged();
+
+    updateCurrentIndex();
+}
+
+void NavigationTabLayout::Private::performLayout()
+{
+    int visibleCount = 0;
+    for (auto tab : std::as_const(tabs)) {
+        if (tab->isVisible()) {
+            ++visibleCount;
+        }
+    }
+
+    // All visible tabs share the available width equally, tabs only get wider
+    // than that when their content does not fit.
+    qreal newTabWidth = 0.0;
+    if (visibleCount > 0) {
+        newTabWidth = std::max(0.0, std::floor((q->width() - spacing * (visibleCount - 1)) / visibleCount));
+    }
+    if (!qFuzzyCompare(newTabWidth, tabWidth)) {
+        tabWidth = newTabWidth;
+        Q_EMIT q->tabWidthChanged();
+    }
+
+    qreal x = 0.0;
+    qreal implicitWidth = 0.0;
+    qreal implicitHeight = 0.0;
+    for (auto tab : std::as_const(tabs)) {
+        if (!tab->isVisible()) {
+            continue;
+        }
+
+        tab->setPosition(QPointF(x, 0.0));
+        x += tab->width() + spacing;
+        implicitWidth += tab->implicitWidth() + spacing;
+        implicitHeight = std::max(implicitHeight, tab->height());
+    }
+
+    if (visibleCount > 0) {
+        implicitWidth -= spacing;
+    }
+    q->setImplicitSize(implicitWidth, implicitHeight);
+}
+
+void NavigationTabLayout::Private::updateCurrentIndex()
+{
+    int newCurrentIndex = -1;
+    for (int i = 0; i < tabs.size(); ++i) {
+        if (tabs.at(i)->property("checked").toBool()) {
+            newCurrentIndex = i;
+            break;
+        }
+    }
+
+    if (newCurrentIndex != currentIndex) {
+        currentIndex = newCurrentIndex;
+        Q_EMIT q->currentIndexChanged();
+    }
+}
+
+void NavigationTabLayout::Private::applyRequestedIndex()
+{
+    if (!hasRequestedIndex) {
+        return;
+    }
+
+    const int index = requestedIndex;
+    hasRequestedIndex = false;
+
+    if (index == currentIndex) {
+        return;
+    }
+
+    if (index == -1) {
+        updatingChecked = true;
+        for (auto tab : std::as_const(tabs)) {
+            tab->setProperty("checked", false);
+        }
+        updatingChecked = false;
+        updateCurrentIndex();
+        return;
+    }
+
+    if (index < 0 || index >= tabs.size()) {
+        return;
+    }
+
+    auto tab = tabs.at(index);
+    if (auto action = tab->property("action").value<QObject *>()) {
+        // Triggering also toggles the action and causes clicked() to be
+        // emitted, toggling the button would not trigger the action.
+        QMetaObject::invokeMethod(action, "trigger");
+    } else {
+        QMetaObject::invokeMethod(tab, "toggle");
+    }
+}
+
+void NavigationTabLayout::Private::releaseDelegateTabs()
+{
+    const auto oldTabs = delegateTabs;
+    delegateTabs.clear();
+    actionTabs.clear();
+    spareTabs.clear();
+
+    for (auto tab : oldTabs) {
+        QObject::disconnect(tab, nullptr, q, nullptr);
+        tabs.removeOne(tab);
+        tab->setParentItem(nullptr);
+        tab->deleteLater();
+    }
+}
+
+void NavigationTabLayout::Private::appendAction(ActionsProperty *list, QObject *action)
+{
+    reinterpret_cast<NavigationTabLayout *>(list->data)->addAction(action);
+}
+
+int NavigationTabLayout::Private::actionCount(ActionsProperty *list)
+{
+    return reinterpret_cast<NavigationTabLayout *>(list->data)->d->actions.count();
+}
+
+QObject *NavigationTabLayout::Private::action(ActionsProperty *list, int index)
+{
+    return reinterpret_cast<NavigationTabLayout *>(list->data)->d->actions.at(index);
+}
+
+void NavigationTabLayout::Private::clearActions(ActionsProperty *list)
+{
+    reinterpret_cast<NavigationTabLayout *>(list->data)->clearActions();
+}
+
+#include "moc_navigationtablayout.cpp"
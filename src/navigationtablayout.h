@@ -0,0 +1,111 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QQuickItem>
+#include <memory>
+
+class QQmlComponent;
+
+/**
+ * The content item of NavigationTabBar.
+ *
+ * Creates a tab from ::delegate for each action in ::actions and lays out all
+ * tabs in a row, including any buttons that were added as children directly.
+ * Tabs are kept per action, and tabs of actions that were removed are reused
+ * for new actions, so assigning a different set of actions does not create
+ * every tab again.
+ *
+ * The checked state of the tabs is tracked here as well: only a single tab is
+ * checked at a time and ::currentIndex follows the checked tab.
+ */
+class NavigationTabLayout : public QQuickItem
+{
+    Q_OBJECT
+    /**
+     * The actions to create tabs for.
+     */
+    Q_PROPERTY(QQmlListProperty<QObject> actions READ actionsProperty NOTIFY actionsChanged)
+    /**
+     * The component used to create tabs for actions. The action is assigned
+     * to the `action` property of the created tab.
+     */
+    Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged)
+    /**
+     * The amount of spacing between tabs.
+     */
+    Q_PROPERTY(qreal spacing READ spacing WRITE setSpacing NOTIFY spacingChanged)
+    /**
+     * The width each visible tab gets, the available width divided equally.
+     */
+    Q_PROPERTY(qreal tabWidth READ tabWidth NOTIFY tabWidthChanged)
+    /**
+     * All tabs in the order they are shown, including hidden tabs.
+     */
+    Q_PROPERTY(QList<QQuickItem *> tabs READ tabs NOTIFY tabsChanged)
+    /**
+     * The number of tabs.
+     */
+    Q_PROPERTY(int count READ count NOTIFY tabsChanged)
+    /**
+     * The index of the checked tab, or -1 if no tab is checked.
+     *
+     * Setting this triggers the action of the tab at the given index. If the
+     * index is out of bounds, or triggering did not check the tab, the index
+     * remains the same.
+     */
+    Q_PROPERTY(int currentIndex READ currentIndex WRITE setCurrentIndex NOTIFY currentIndexChanged)
+
+public:
+    using ActionsProperty = QQmlListProperty<QObject>;
+
+    NavigationTabLayout(QQuickItem *parent = nullptr);
+    ~NavigationTabLayout() override;
+
+    ActionsProperty actionsProperty() const;
+    void addAction(QObject *action);
+    void clearActions();
+    Q_SIGNAL void actionsChanged();
+
+    QQmlComponent *delegate() const;
+    void setDelegate(QQmlComponent *newDelegate);
+    Q_SIGNAL void delegateChanged();
+
+    qreal spacing() const;
+    void setSpacing(qreal newSpacing);
+    Q_SIGNAL void spacingChanged();
+
+    qreal tabWidth() const;
+    Q_SIGNAL void tabWidthChanged();
+
+    QList<QQuickItem *> tabs() const;
+    int count() const;
+    Q_SIGNAL void tabsChanged();
+
+    int currentIndex() const;
+    void setCurrentIndex(int newCurrentIndex);
+    Q_SIGNAL void currentIndexChanged();
+
+    /**
+     * Queue a relayout of this layout.
+     *
+     * \note The layouting happens during the next scene graph polishing phase.
+     */
+    Q_SLOT void relayout();
+
+protected:
+    void componentComplete() override;
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &data) override;
+    void updatePolish() override;
+
+private:
+    Q_SLOT void onTabCheckedChanged();
+
+    class Private;
+    const std::unique_ptr<Private> d;
+};
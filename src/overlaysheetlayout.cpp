@@ -0,0 +1,337 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "overlaysheetlayout.h"
+
+#include <QMetaMethod>
+
+#include <algorithm>
+
+OverlaySheetLayout::OverlaySheetLayout(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+}
+
+OverlaySheetLayout::~OverlaySheetLayout()
+{
+}
+
+QQuickItem *OverlaySheetLayout::viewport() const
+{
+    return m_viewport;
+}
+
+void OverlaySheetLayout::setViewport(QQuickItem *viewport)
+{
+    if (viewport == m_viewport) {
+        return;
+    }
+
+    setTrackedItem(m_viewport, viewport);
+    if (m_viewport) {
+        // Flickable is private API, connect to its content height by name.
+        static const QMetaMethod relayoutSlot = staticMetaObject.method(staticMetaObject.indexOfMethod("relayout()"));
+        const auto metaObject = m_viewport->metaObject();
+        const int index = metaObject->indexOfProperty("contentHeight");
+        if (index >= 0 && metaObject->property(index).hasNotifySignal()) {
+            connect(m_viewport, metaObject->property(index).notifySignal(), this, relayoutSlot);
+        }
+    }
+    m_viewportHeight = -1.0;
+    Q_EMIT viewportChanged();
+}
+
+QQuickItem *OverlaySheetLayout::sheet() const
+{
+    return m_sheet;
+}
+
+void OverlaySheetLayout::setSheet(QQuickItem *sheet)
+{
+    if (sheet == m_sheet) {
+        return;
+    }
+
+    setTrackedItem(m_sheet, sheet);
+    Q_EMIT sheetChanged();
+}
+
+QQuickItem *OverlaySheetLayout::headerBar() const
+{
+    return m_headerBar;
+}
+
+void OverlaySheetLayout::setHeaderBar(QQuickItem *headerBar)
+{
+    if (headerBar == m_headerBar) {
+        return;
+    }
+
+    setTrackedItem(m_headerBar, headerBar);
+    Q_EMIT headerBarChanged();
+}
+
+QQuickItem *OverlaySheetLayout::footerBar() const
+{
+    return m_footerBar;
+}
+
+void OverlaySheetLayout::setFooterBar(QQuickItem *footerBar)
+{
+    if (footerBar == m_footerBar) {
+        return;
+    }
+
+    setTrackedItem(m_footerBar, footerBar);
+    Q_EMIT footerBarChanged();
+}
+
+QQuickItem *OverlaySheetLayout::header() const
+{
+    return m_header;
+}
+
+void OverlaySheetLayout::setHeader(QQuickItem *header)
+{
+    if (header == m_header) {
+        return;
+    }
+
+    m_header = header;
+    relayout();
+    Q_EMIT headerChanged();
+}
+
+QQuickItem *OverlaySheetLayout::headerContainer() const
+{
+    return m_headerContainer;
+}
+
+void OverlaySheetLayout::setHeaderContainer(QQuickItem *container)
+{
+    if (container == m_headerContainer) {
+        return;
+    }
+
+    setTrackedItem(m_headerContainer, container, true);
+    Q_EMIT headerContainerChanged();
+}
+
+QQuickItem *OverlaySheetLayout::footer() const
+{
+    return m_footer;
+}
+
+void OverlaySheetLayout::setFooter(QQuickItem *footer)
+{
+    if (footer == m_footer) {
+        return;
+    }
+
+    m_footer = footer;
+    relayout();
+    Q_EMIT footerChanged();
+}
+
+QQuickItem *OverlaySheetLayout::footerContainer() const
+{
+    return m_footerContainer;
+}
+
+void OverlaySheetLayout::setFooterContainer(QQuickItem *container)
+{
+    if (container == m_footerContainer) {
+        return;
+    }
+
+    setTrackedItem(m_footerContainer, container, true);
+    Q_EMIT footerContainerChanged();
+}
+
+qreal OverlaySheetLayout::preferredWidth() const
+{
+    return m_preferredWidth;
+}
+
+void OverlaySheetLayout::setPreferredWidth(qreal width)
+{
+    if (qFuzzyCompare(width, m_preferredWidth)) {
+        return;
+    }
+
+    m_preferredWidth = width;
+    updateSheetWidth();
+    Q_EMIT preferredWidthChanged();
+}
+
+qreal OverlaySheetLayout::maximumWidth() const
+{
+    return m_maximumWidth;
+}
+
+void OverlaySheetLayout::setMaximumWidth(qreal width)
+{
+    if (qFuzzyCompare(width, m_maximumWidth)) {
+        return;
+    }
+
+    m_maximumWidth = width;
+    updateSheetWidth();
+    Q_EMIT maximumWidthChanged();
+}
+
+bool OverlaySheetLayout::isOpen() const
+{
+    return m_open;
+}
+
+void OverlaySheetLayout::setOpen(bool open)
+{
+    if (open == m_open) {
+        return;
+    }
+
+    m_open = open;
+    relayout();
+    Q_EMIT openChanged();
+}
+
+qreal OverlaySheetLayout::sheetWidth() const
+{
+    return m_sheetWidth;
+}
+
+qreal OverlaySheetLayout::openPosition() const
+{
+    return m_openPosition;
+}
+
+void OverlaySheetLayout::relayout()
+{
+    if (m_completed) {
+        polish();
+    }
+}
+
+void OverlaySheetLayout::componentComplete()
+{
+    QQuickItem::componentComplete();
+    m_completed = true;
+    updateSheetWidth();
+    relayout();
+}
+
+void OverlaySheetLayout::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+    if (newGeometry.width() != oldGeometry.width()) {
+        updateSheetWidth();
+    }
+}
+
+void OverlaySheetLayout::updatePolish()
+{
+    placeInContainer(m_header, m_headerContainer);
+    placeInContainer(m_footer, m_footerContainer);
+
+    if (!m_viewport || !m_sheet) {
+        return;
+    }
+
+    const qreal viewportHeight = m_viewport->height();
+    const qreal contentHeight = m_viewport->property("contentHeight").toReal();
+    const qreal headerHeight = m_headerBar ? m_headerBar->height() : 0.0;
+    const qreal footerHeight = m_footerBar ? m_footerBar->height() : 0.0;
+
+    // Centered when the sheet fits in the viewport, the top of the sheet at
+    // the top of the viewport otherwise.
+    const qreal openPosition =
+        std::max(0.0, viewportHeight - contentHeight + headerHeight + footerHeight) + viewportHeight / 2.0 - m_sheet->height() / 2.0;
+
+    bool reposition = false;
+
+    if (!qFuzzyCompare(openPosition, m_openPosition)) {
+        m_openPosition = openPosition;
+        Q_EMIT openPositionChanged();
+        reposition = true;
+    }
+
+    if (!qFuzzyCompare(viewportHeight, m_viewportHeight)) {
+        m_viewportHeight = viewportHeight;
+        reposition = true;
+    }
+
+    // A content height change only matters while the sheet looks like a
+    // dialog, or when it did before the change.
+    if (!qFuzzyCompare(contentHeight, m_viewportContentHeight)) {
+        if (contentHeight < viewportHeight || m_viewportContentHeight < viewportHeight) {
+            reposition = true;
+        }
+        m_viewportContentHeight = contentHeight;
+    }
+
+    if (reposition && m_open) {
+        Q_EMIT repositionRequested();
+    }
+}
+
+void OverlaySheetLayout::track(QQuickItem *item, bool trackWidth)
+{
+    connect(item, &QQuickItem::heightChanged, this, &OverlaySheetLayout::relayout);
+    if (trackWidth) {
+        connect(item, &QQuickItem::widthChanged, this, &OverlaySheetLayout::relayout);
+    }
+}
+
+void OverlaySheetLayout::untrack(QQuickItem *item)
+{
+    disconnect(item, nullptr, this, nullptr);
+}
+
+void OverlaySheetLayout::setTrackedItem(QPointer<QQuickItem> &member, QQuickItem *item, bool trackWidth)
+{
+    if (member) {
+        untrack(member);
+    }
+    member = item;
+    if (member) {
+        track(member, trackWidth);
+    }
+    relayout();
+}
+
+void OverlaySheetLayout::placeInContainer(QQuickItem *item, QQuickItem *container)
+{
+    if (!item || !container) {
+        return;
+    }
+
+    if (item->parentItem() != container) {
+        item->setParentItem(container);
+    }
+    item->setPosition(QPointF(0.0, 0.0));
+    item->setSize(container->size());
+}
+
+void OverlaySheetLayout::updateSheetWidth()
+{
+    const qreal availableWidth = width();
+
+    qreal sheetWidth = availableWidth;
+    if (m_preferredWidth > 0.0) {
+        sheetWidth = std::max(availableWidth / 2.0, m_preferredWidth);
+        if (m_maximumWidth > 0.0) {
+            sheetWidth = std::min(m_maximumWidth, sheetWidth);
+        }
+    }
+
+    if (!qFuzzyCompare(sheetWidth, m_sheetWidth)) {
+        m_sheetWidth = sheetWidth;
+        Q_EMIT sheetWidthChanged();
+    }
+}
+
+#include "moc_overlaysheetlayout.cpp"
@@ -0,0 +1,172 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QPointer>
+#include <QQuickItem>
+
+/**
+ * Geometry helper for OverlaySheet.
+ *
+ * Collects every change that affects where the sheet should be, such as the
+ * size of the viewport, the height of the content and the height of header
+ * and footer, and resolves them in a single polish pass per frame. The
+ * resulting sheet width and open position are exposed as properties, and
+ * repositionRequested() is emitted at most once per pass when the sheet has
+ * to move to its open position.
+ *
+ * The item is expected to fill the area the sheet is shown in, its width is
+ * used as the available width.
+ */
+class OverlaySheetLayout : public QQuickItem
+{
+    Q_OBJECT
+
+    /**
+     * The flickable the sheet scrolls in.
+     */
+    Q_PROPERTY(QQuickItem *viewport READ viewport WRITE setViewport NOTIFY viewportChanged)
+    /**
+     * The item holding header, content and footer of the sheet.
+     */
+    Q_PROPERTY(QQuickItem *sheet READ sheet WRITE setSheet NOTIFY sheetChanged)
+    /**
+     * The header bar of the sheet, its height is reserved at the top.
+     */
+    Q_PROPERTY(QQuickItem *headerBar READ headerBar WRITE setHeaderBar NOTIFY headerBarChanged)
+    /**
+     * The footer bar of the sheet, its height is reserved at the bottom.
+     */
+    Q_PROPERTY(QQuickItem *footerBar READ footerBar WRITE setFooterBar NOTIFY footerBarChanged)
+    /**
+     * The header provided by the user, placed into headerContainer.
+     */
+    Q_PROPERTY(QQuickItem *header READ header WRITE setHeader NOTIFY headerChanged)
+    Q_PROPERTY(QQuickItem *headerContainer READ headerContainer WRITE setHeaderContainer NOTIFY headerContainerChanged)
+    /**
+     * The footer provided by the user, placed into footerContainer.
+     */
+    Q_PROPERTY(QQuickItem *footer READ footer WRITE setFooter NOTIFY footerChanged)
+    Q_PROPERTY(QQuickItem *footerContainer READ footerContainer WRITE setFooterContainer NOTIFY footerContainerChanged)
+    /**
+     * The width the content asks for, 0 or less to use all available width.
+     */
+    Q_PROPERTY(qreal preferredWidth READ preferredWidth WRITE setPreferredWidth NOTIFY preferredWidthChanged)
+    /**
+     * The maximum width of the sheet, 0 or less for no maximum.
+     */
+    Q_PROPERTY(qreal maximumWidth READ maximumWidth WRITE setMaximumWidth NOTIFY maximumWidthChanged)
+    /**
+     * Whether the sheet is open. No repositioning is requested while closed.
+     */
+    Q_PROPERTY(bool open READ isOpen WRITE setOpen NOTIFY openChanged)
+    /**
+     * The width of the sheet, including insets.
+     */
+    Q_PROPERTY(qreal sheetWidth READ sheetWidth NOTIFY sheetWidthChanged)
+    /**
+     * The contentY of the viewport at which the sheet is shown centered, or
+     * at the top when it is taller than the viewport.
+     */
+    Q_PROPERTY(qreal openPosition READ openPosition NOTIFY openPositionChanged)
+
+public:
+    explicit OverlaySheetLayout(QQuickItem *parent = nullptr);
+    ~OverlaySheetLayout() override;
+
+    QQuickItem *viewport() const;
+    void setViewport(QQuickItem *viewport);
+
+    QQuickItem *sheet() const;
+    void setSheet(QQuickItem *sheet);
+
+    QQuickItem *headerBar() const;
+    void setHeaderBar(QQuickItem *headerBar);
+
+    QQuickItem *footerBar() const;
+    void setFooterBar(QQuickItem *footerBar);
+
+    QQuickItem *header() const;
+    void setHeader(QQuickItem *header);
+
+    QQuickItem *headerContainer() const;
+    void setHeaderContainer(QQuickItem *container);
+
+    QQuickItem *footer() const;
+    void setFooter(QQuickItem *footer);
+
+    QQuickItem *footerContainer() const;
+    void setFooterContainer(QQuickItem *container);
+
+    qreal preferredWidth() const;
+    void setPreferredWidth(qreal width);
+
+    qreal maximumWidth() const;
+    void setMaximumWidth(qreal width);
+
+    bool isOpen() const;
+    void setOpen(bool open);
+
+    qreal sheetWidth() const;
+    qreal openPosition() const;
+
+    /**
+     * Queue a relayout, done during the next polish phase.
+     */
+    Q_SLOT void relayout();
+
+Q_SIGNALS:
+    void viewportChanged();
+    void sheetChanged();
+    void headerBarChanged();
+    void footerBarChanged();
+    void headerChanged();
+    void headerContainerChanged();
+    void footerChanged();
+    void footerContainerChanged();
+    void preferredWidthChanged();
+    void maximumWidthChanged();
+    void openChanged();
+    void sheetWidthChanged();
+    void openPositionChanged();
+
+    /**
+     * Emitted when the viewport should scroll to openPosition.
+     */
+    void repositionRequested();
+
+protected:
+    void componentComplete() override;
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void updatePolish() override;
+
+private:
+    void track(QQuickItem *item, bool trackWidth = false);
+    void untrack(QQuickItem *item);
+    void setTrackedItem(QPointer<QQuickItem> &member, QQuickItem *item, bool trackWidth = false);
+    void placeInContainer(QQuickItem *item, QQuickItem *container);
+    void updateSheetWidth();
+
+    QPointer<QQuickItem> m_viewport;
+    QPointer<QQuickItem> m_sheet;
+    QPointer<QQuickItem> m_headerBar;
+    QPointer<QQuickItem> m_footerBar;
+    QPointer<QQuickItem> m_header;
+    QPointer<QQuickItem> m_headerContainer;
+    QPointer<QQuickItem> m_footer;
+    QPointer<QQuickItem> m_footerContainer;
+    qreal m_preferredWidth = 0.0;
+    qreal m_maximumWidth = 0.0;
+    bool m_open = false;
+    bool m_completed = false;
+
+    qreal m_sheetWidth = 0.0;
+    qreal m_openPosition = 0.0;
+    qreal m_viewportHeight = -1.0;
+    qreal m_viewportContentHeight = 0.0;
+    bool m_wasOpen = false;
+};
@@ -0,0 +1,93 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "pageactioncollector.h"
+
+#include <QMetaMethod>
+#include <QQmlListReference>
+
+static const char *s_groupProperties[] = {"main", "left", "right", "contextualActions"};
+
+PageActionCollector::PageActionCollector(QObject *parent)
+    : QObject(parent)
+{
+}
+
+PageActionCollector::~PageActionCollector()
+{
+}
+
+QObject *PageActionCollector::group() const
+{
+    return m_group;
+}
+
+void PageActionCollector::setGroup(QObject *group)
+{
+    if (group == m_group) {
+        return;
+    }
+
+    if (m_group) {
+        disconnect(m_group, nullptr, this, nullptr);
+    }
+
+    m_group = group;
+
+    if (m_group) {
+        // The group is defined in QML, connect to its properties by name.
+        static const QMetaMethod updateSlot = staticMetaObject.method(staticMetaObject.indexOfMethod("update()"));
+        const auto metaObject = m_group->metaObject();
+        for (auto name : s_groupProperties) {
+            const int index = metaObject->indexOfProperty(name);
+            if (index >= 0 && metaObject->property(index).hasNotifySignal()) {
+                connect(m_group, metaObject->property(index).notifySignal(), this, updateSlot);
+            }
+        }
+        connect(m_group, &QObject::destroyed, this, &PageActionCollector::update);
+    }
+
+    update();
+    Q_EMIT groupChanged();
+}
+
+QList<QObject *> PageActionCollector::actions() const
+{
+    return m_actions;
+}
+
+void PageActionCollector::update()
+{
+    QList<QObject *> actions;
+
+    if (m_group) {
+        for (auto name : {"main", "left", "right"}) {
+            if (auto action = m_group->property(name).value<QObject *>()) {
+                actions.append(action);
+            }
+        }
+
+        QQmlListReference contextualActions(m_group, "contextualActions");
+        if (contextualActions.isValid()) {
+            const int count = contextualActions.count();
+            actions.reserve(actions.size() + count);
+            for (int i = 0; i < count; ++i) {
+                if (auto action = contextualActions.at(i)) {
+                    actions.append(action);
+                }
+            }
+        }
+    }
+
+    if (actions == m_actions) {
+        return;
+    }
+
+    m_actions = actions;
+    Q_EMIT actionsChanged();
+}
+
+#include "moc_pageactioncollector.cpp"
@@ -0,0 +1,52 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QPointer>
+
+/**
+ * Flattens the actions of a page into a single list.
+ *
+ * Watches the main, left, right and contextual actions of a page's action
+ * group and provides them as one list, in that order. The list is only
+ * rebuilt when one of them changes, and actionsChanged() is only emitted when
+ * the result differs from the previous list, so a toolbar showing the list
+ * keeps its delegates when nothing changed.
+ */
+class PageActionCollector : public QObject
+{
+    Q_OBJECT
+
+    /**
+     * The action group of the page, Page::actions.
+     */
+    Q_PROPERTY(QObject *group READ group WRITE setGroup NOTIFY groupChanged)
+    /**
+     * The actions of the group, without empty entries.
+     */
+    Q_PROPERTY(QList<QObject *> actions READ actions NOTIFY actionsChanged)
+
+public:
+    explicit PageActionCollector(QObject *parent = nullptr);
+    ~PageActionCollector() override;
+
+    QObject *group() const;
+    void setGroup(QObject *group);
+
+    QList<QObject *> actions() const;
+
+Q_SIGNALS:
+    void groupChanged();
+    void actionsChanged();
+
+private:
+    Q_SLOT void update();
+
+    QPointer<QObject> m_group;
+    QList<QObject *> m_actions;
+};
@@ -13,40 +13,112 @@
 #include <QQmlProperty>
 #include <QQuickWindow>
 #include <QTimer>
+#include <QUrlQuery>
 #include <qqmlpropertymap.h>
 
-ParsedRoute *parseRoute(QJSValue value)
+static const int s_routeTemplatesCacheSize = 256;
+
+static ParsedRoute *parseRouteObject(const QVariantMap &object)
+{
+    auto properties = object;
+    properties.remove(QStringLiteral("route"));
+    properties.remove(QStringLiteral("data"));
+    return new ParsedRoute{object.value(QStringLiteral("route")).toString(), object.value(QStringLiteral("data")), properties, false, nullptr};
+}
+
+static ParsedRoute *fromTemplate(const RouteTemplate &route)
+{
+    return new ParsedRoute{route.name, route.data, route.properties, false, nullptr};
+}
+
+QVector<RouteTemplate> PageRouter::parseRouteString(const QString &route) const
+{
+    // A defined name always wins, so existing names containing the separators
+    // keep working.
+    if (route.isEmpty() || routesContainsKey(route)) {
+        return {RouteTemplate{route, QVariant(), QVariantMap()}};
+    }
+
+    QVector<RouteTemplate> ret;
+    const auto segments = route.splitRef(QLatin1Char('/'), Qt::SkipEmptyParts);
+    ret.reserve(segments.size());
+    for (const auto &segment : segments) {
+        const int queryStart = segment.indexOf(QLatin1Char('?'));
+        RouteTemplate parsed;
+        parsed.name = segment.left(queryStart).toString();
+        if (!routesContainsKey(parsed.name) && routesContainsKey(QLatin1Char('/') + parsed.name)) {
+            parsed.name.prepend(QLatin1Char('/'));
+        }
+
+        if (queryStart >= 0) {
+            const QUrlQuery query(segment.mid(queryStart + 1).toString());
+            const auto items = query.queryItems(QUrl::FullyDecoded);
+            for (const auto &item : items) {
+                if (item.first == QLatin1String("data")) {
+                    parsed.data = item.second;
+                } else {
+                    parsed.properties.insert(item.first, item.second);
+                }
+            }
+        }
+        ret << parsed;
+    }
+
+    if (ret.isEmpty()) {
+        ret << RouteTemplate{route, QVariant(), QVariantMap()};
+    }
+    return ret;
+}
+
+QVector<RouteTemplate> PageRouter::routeTemplates(const QString &route)
+{
+    if (auto templates = m_routeTemplates.object(route)) {
+        return *templates;
+    }
+
+    const auto templates = parseRouteString(route);
+    m_routeTemplates.insert(route, new QVector<RouteTemplate>(templates));
+    return templates;
+}
+
+ParsedRoute *PageRouter::parseRoute(const QJSValue &value)
 {
     if (value.isUndefined()) {
         return new ParsedRoute{};
     } else if (value.isString()) {
-        return new ParsedRoute{value.toString(), QVariant()};
+        const auto templates = routeTemplates(value.toString());
+        if (templates.size() > 1) {
+            // Only a single route is wanted here, guessing which segment was
+            // meant would silently do something else than asked for.
+            qCWarning(KirigamiLog) << "Expected a single route, but" << value.toString() << "is a path of" << templates.size()
+                                   << "routes. Use a route name or a single segment instead.";
+            return new ParsedRoute{value.toString(), QVariant(), QVariantMap(), false, nullptr};
+        }
+        return fromTemplate(templates.constFirst());
     } else {
-        auto map = value.toVariant().value<QVariantMap>();
-        map.remove(QStringLiteral("route"));
-        map.remove(QStringLiteral("data"));
-        return new ParsedRoute{value.property(QStringLiteral("route")).toString(), //
-                               value.property(QStringLiteral("data")).toVariant(),
-                               map,
-                               false};
+        return parseRouteObject(value.toVariant().value<QVariantMap>());
     }
 }
 
-QList<ParsedRoute *> parseRoutes(QJSValue values)
+QList<ParsedRoute *> PageRouter::parseRoutes(const QJSValue &values)
 {
     QList<ParsedRoute *> ret;
-    if (values.isArray()) {
-        const auto valuesList = values.toVariant().toList();
-        for (const auto &route : valuesList) {
-            if (route.toString() != QString()) {
-                ret << new ParsedRoute{route.toString(), QVariant(), QVariantMap(), false, nullptr};
-            } else if (route.canConvert<QVariantMap>()) {
-                auto map = route.value<QVariantMap>();
-                auto copy = map;
-                copy.remove(QStringLiteral("route"));
-                copy.remove(QStringLiteral("data"));
-
-                ret << new ParsedRoute{map.value(QStringLiteral("route")).toString(), map.value(QStringLiteral("data")), copy, false, nullptr};
+    if (values.isString()) {
+        const auto templates = routeTemplates(values.toString());
+        for (const auto &route : templates) {
+            ret << fromTemplate(route);
+        }
+    } else if (values.isArray()) {
+        const int length = values.property(QStringLiteral("length")).toInt();
+        for (int i = 0; i < length; ++i) {
+            const auto value = values.property(i);
+            if (value.isString()) {
+                const auto templates = routeTemplates(value.toString());
+                for (const auto &route : templates) {
+                    ret << fromTemplate(route);
+                }
+            } else if (value.isObject()) {
+                ret << parseRouteObject(value.toVariant().value<QVariantMap>());
             }
         }
     } else {
@@ -60,6 +132,7 @@ PageRouter::PageRouter(QQuickItem *parent)
     , m_paramMap(new QQmlPropertyMap)
     , m_cache()
     , m_preload()
+    , m_routeTemplates(s_routeTemplatesCacheSize)
 {
     connect(this, &PageRouter::pageStackChanged, [=]() {
         connect(m_pageStack, &ColumnView::currentIndexChanged, this, &PageRouter::currentIndexChanged);
@@ -75,6 +148,8 @@ void PageRouter::appendRoute(QQmlListProperty<PageRoute> *prop, PageRoute *route
 {
     auto router = qobject_cast<PageRouter *>(prop->object);
     router->m_routes.append(route);
+    router->m_routeTemplates.clear();
+    router->m_propertyIndices.clear();
 }
 
 int PageRouter::routeCount(QQmlListProperty<PageRoute> *prop)
@@ -93,6 +168,8 @@ void PageRouter::clearRoutes(QQmlListProperty<PageRoute> *prop)
 {
     auto router = qobject_cast<PageRouter *>(prop->object);
     router->m_routes.clear();
+    router->m_routeTemplates.clear();
+    router->m_propertyIndices.clear();
 }
 
 PageRouter::~PageRouter()
@@ -112,7 +189,10 @@ void PageRouter::componentComplete()
     } else {
         Q_EMIT pageStackChanged();
         m_currentRoutes.clear();
-        push(parseRoute(initialRoute()));
+        const auto initialRoutes = parseRoutes(initialRoute());
+        for (auto route : initialRoutes) {
+            push(route);
+        }
     }
 }
 
@@ -192,8 +272,8 @@ void PageRouter::push(ParsedRoute *route)
         auto push = [route, this](ParsedRoute *item) {
             m_currentRoutes << item;
 
+            applyProperties(routesValueForKey(route->name), item->item, route->properties);
             for (auto it = route->properties.begin(); it != route->properties.end(); it++) {
-                item->item->setProperty(qUtf8Printable(it.key()), it.value());
                 item->properties[it.key()] = it.value();
             }
             reevaluateParamMapProperties();
@@ -226,9 +306,7 @@ void PageRouter::push(ParsedRoute *route)
         if (!qqItem) {
             qCCritical(KirigamiLog) << "Route" << route->name << "is not an item! This is undefined behaviour and will likely crash your application.";
         }
-        for (auto it = route->properties.begin(); it != route->properties.end(); it++) {
-            qqItem->setProperty(qUtf8Printable(it.key()), it.value());
-        }
+        applyInitialProperties(component, item, route->properties);
         route->setItem(qqItem);
         route->cache = routesCacheForKey(route->name);
         m_currentRoutes << route;
@@ -256,6 +334,45 @@ void PageRouter::push(ParsedRoute *route)
     }
 }
 
+int PageRouter::propertyIndex(QQmlComponent *component, QObject *object, const QString &key)
+{
+    const auto cacheKey = qMakePair(component, key);
+    auto it = m_propertyIndices.constFind(cacheKey);
+    if (it == m_propertyIndices.constEnd()) {
+        it = m_propertyIndices.insert(cacheKey, object->metaObject()->indexOfProperty(key.toUtf8().constData()));
+    }
+    return *it;
+}
+
+void PageRouter::applyProperties(QQmlComponent *component, QObject *object, const QVariantMap &properties)
+{
+    for (auto it = properties.constBegin(); it != properties.constEnd(); it++) {
+        const int index = propertyIndex(component, object, it.key());
+        if (index >= 0) {
+            object->metaObject()->property(index).write(object, it.value());
+        } else {
+            // Not a declared property, keep it as a dynamic one.
+            object->setProperty(qUtf8Printable(it.key()), it.value());
+        }
+    }
+}
+
+void PageRouter::applyInitialProperties(QQmlComponent *component, QObject *object, const QVariantMap &properties)
+{
+    QVariantMap initialProperties;
+    for (auto it = properties.constBegin(); it != properties.constEnd(); it++) {
+        if (propertyIndex(component, object, it.key()) >= 0) {
+            initialProperties.insert(it.key(), it.value());
+        } else {
+            object->setProperty(qUtf8Printable(it.key()), it.value());
+        }
+    }
+
+    if (!initialProperties.isEmpty()) {
+        component->setInitialProperties(object, initialProperties);
+    }
+}
+
 QJSValue PageRouter::initialRoute() const
 {
     return m_initialRoute;
@@ -352,7 +469,10 @@ bool PageRouter::routeActive(QJSValue route)
 
 void PageRouter::pushRoute(QJSValue route)
 {
-    push(parseRoute(route));
+    const auto parsed = parseRoutes(route);
+    for (auto toPush : parsed) {
+        push(toPush);
+    }
     Q_EMIT navigationChanged();
 }
 
@@ -486,9 +606,7 @@ void PageRouter::preload(ParsedRoute *route)
         if (!qqItem) {
             qCCritical(KirigamiLog) << "Route" << route->name << "is not an item! This is undefined behaviour and will likely crash your application.";
         }
-        for (auto it = route->properties.begin(); it != route->properties.end(); it++) {
-            qqItem->setProperty(qUtf8Printable(it.key()), it.value());
-        }
+        applyInitialProperties(component, item, route->properties);
         route->setItem(qqItem);
         route->cache = routesCacheForKey(route->name);
         auto attached = qobject_cast<PageRouterAttached *>(qmlAttachedPropertiesObject<PageRouter>(item, true));
@@ -541,7 +659,7 @@ void PreloadRouteGroup::handleChange()
         return;
     }
     auto r = m_parent->m_router;
-    auto parsed = parseRoute(m_route);
+    auto parsed = r->parseRoute(m_route);
     if (m_when) {
         r->preload(parsed);
     } else {
@@ -552,7 +670,7 @@ void PreloadRouteGroup::handleChange()
 PreloadRouteGroup::~PreloadRouteGroup()
 {
     if (m_parent->m_router) {
-        m_parent->m_router->unpreload(parseRoute(m_route));
+        m_parent->m_router->unpreload(m_parent->m_router->parseRoute(m_route));
     }
 }
 
@@ -84,6 +84,18 @@ public:
     }
 };
 
+/**
+ * An immutable route parsed from a route string.
+ *
+ * Route strings are parsed once per PageRouter and kept as templates, which
+ * are then used to create ParsedRoutes without going through the JS engine.
+ */
+struct RouteTemplate {
+    QString name;
+    QVariant data;
+    QVariantMap properties;
+};
+
 struct LRU {
     int size = 10;
     QList<QPair<QString, quint32>> evictionList;
@@ -496,6 +508,67 @@ private:
     void preload(ParsedRoute *route);
     void unpreload(ParsedRoute *route);
 
+    /**
+     * @brief Parsed route strings.
+     *
+     * Navigation mostly repeats the same route expressions, so the result of
+     * parsing a route string is kept around. Cleared when the routes change,
+     * as parsing depends on the defined route names.
+     */
+    QCache<QString, QVector<RouteTemplate>> m_routeTemplates;
+
+    /**
+     * @brief Parse a route string into one or more route templates.
+     *
+     * A route string is either the name of a route or a compact path like
+     * `"home/login?data=red&title=Login"`. Segments are separated by `/` and
+     * each segment can have a query, whose `data` key is used as the route's
+     * data and all other keys as properties. A segment matches a route called
+     * either `segment` or `/segment`.
+     */
+    QVector<RouteTemplate> parseRouteString(const QString &route) const;
+
+    /**
+     * @brief Helper function to access cached templates for a route string.
+     */
+    QVector<RouteTemplate> routeTemplates(const QString &route);
+
+    /**
+     * @brief Parse a value describing a single route.
+     *
+     * A string describing a path of several routes is rejected with a
+     * warning; it is used as a route name as is, which won't match.
+     */
+    ParsedRoute *parseRoute(const QJSValue &value);
+    QList<ParsedRoute *> parseRoutes(const QJSValue &values);
+
+    /**
+     * @brief Property indices of route properties, per component and key.
+     *
+     * All pages created from a component share the same properties, so
+     * the lookup by name is only done once. -1 marks a key that is not a
+     * declared property of the page. Cleared whenever the routes change.
+     */
+    QHash<QPair<QQmlComponent *, QString>, int> m_propertyIndices;
+
+    /**
+     * @brief Helper function to look up the index of a route property on @p object.
+     */
+    int propertyIndex(QQmlComponent *component, QObject *object, const QString &key);
+
+    /**
+     * @brief Apply @p properties to a page that was already created.
+     */
+    void applyProperties(QQmlComponent *component, QObject *object, const QVariantMap &properties);
+
+    /**
+     * @brief Apply @p properties to a page between beginCreate() and completeCreate().
+     *
+     * Declared properties are passed as initial properties, which replaces any
+     * binding on them instead of having the binding overwrite them later.
+     */
+    void applyInitialProperties(QQmlComponent *component, QObject *object, const QVariantMap &properties);
+
     void placeInCache(ParsedRoute *route);
 
     static void appendRoute(QQmlListProperty<PageRoute> *list, PageRoute *);
@@ -566,6 +639,15 @@ public:
      * Navigating to a route not defined in a PageRouter's routes is undefined
      * behavior.
      *
+     * A string can also contain several routes separated by `/`, each of
+     * them optionally followed by a query setting its data and properties.
+     * Such strings are parsed once and then reused, which makes them the
+     * cheapest way to express routes that are navigated to repeatedly.
+     * @code{.js}
+     * // Same as ["home", {"route": "login", "data": "red", "title": "Login"}]
+     * Kirigami.PageRouter.navigateToRoute("home/login?data=red&title=Login")
+     * @endcode
+     *
      * @code{.qml}
      * Button {
      *     text: "Login"
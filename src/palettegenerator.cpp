@@ -0,0 +1,354 @@
+/*
+ *  Copyright 2020 Marco Martin <mart@kde.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  2.010-1301, USA.
+ */
+
+#include "palettegenerator.h"
+#include "colorutils.h"
+
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+
+int PaletteGenerator::squareDistance(QRgb color1, QRgb color2)
+{
+    // https://en.wikipedia.org/wiki/Color_difference
+    // Using RGB distance for performance, as CIEDE2000 istoo complicated
+    if (qRed(color1) - qRed(color2) < 128) {
+        return 2 * pow(qRed(color1) - qRed(color2), 2) //
+            + 4 * pow(qGreen(color1) - qGreen(color2), 2) //
+            + 3 * pow(qBlue(color1) - qBlue(color2), 2);
+    } else {
+        return 3 * pow(qRed(color1) - qRed(color2), 2) //
+            + 4 * pow(qGreen(color1) - qGreen(color2), 2) //
+            + 2 * pow(qBlue(color1) - qBlue(color2), 2);
+    }
+}
+
+void PaletteGenerator::positionColor(QRgb rgb, QList<ImageData::colorStat> &clusters)
+{
+    for (auto &stat : clusters) {
+        if (squareDistance(rgb, stat.centroid) < s_minimumSquareDistance) {
+            stat.colors.append(rgb);
+            return;
+        }
+    }
+
+    ImageData::colorStat stat;
+    stat.colors.append(rgb);
+    stat.centroid = rgb;
+    clusters << stat;
+}
+
+PaletteGenerator::RegionData PaletteGenerator::clusterRegion(const QImage &sourceImage, const QRect &rect, const QList<QRgb> &seeds, int iterations)
+{
+    RegionData region;
+
+    // Warm start from the centroids of a previous palette
+    for (const QRgb seed : seeds) {
+        ImageData::colorStat stat;
+        stat.centroid = seed;
+        region.clusters << stat;
+    }
+
+    QColor sampleColor;
+    for (int x = rect.left(); x <= rect.right(); ++x) {
+        for (int y = rect.top(); y <= rect.bottom(); ++y) {
+            sampleColor = sourceImage.pixelColor(x, y);
+            if (sampleColor.alpha() == 0) {
+                continue;
+            }
+            QRgb rgb = sampleColor.rgb();
+            region.red += qRed(rgb);
+            region.green += qGreen(rgb);
+            region.blue += qBlue(rgb);
+            region.samples << rgb;
+            positionColor(rgb, region.clusters);
+        }
+    }
+
+    if (region.samples.isEmpty()) {
+        return region;
+    }
+
+    // Drop the seeds no sample is close to anymore
+    region.clusters.erase(std::remove_if(region.clusters.begin(),
+                                         region.clusters.end(),
+                                         [](const ImageData::colorStat &stat) {
+                                             return stat.colors.isEmpty();
+                                         }),
+                          region.clusters.end());
+
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+        for (auto &stat : region.clusters) {
+            qint64 r = 0;
+            qint64 g = 0;
+            qint64 b = 0;
+            qint64 c = 0;
+
+            for (auto color : std::as_const(stat.colors)) {
+                c++;
+                r += qRed(color);
+                g += qGreen(color);
+                b += qBlue(color);
+            }
+            r = r / c;
+            g = g / c;
+            b = b / c;
+            stat.centroid = qRgb(r, g, b);
+            stat.ratio = qreal(stat.colors.count()) / qreal(region.samples.count());
+            stat.colors = QList<QRgb>({stat.centroid});
+        }
+
+        for (auto color : std::as_const(region.samples)) {
+            positionColor(color, region.clusters);
+        }
+    }
+
+    return region;
+}
+
+void PaletteGenerator::compressClusters(QList<ImageData::colorStat> &clusters)
+{
+    // compress blocks that became too similar
+    auto sourceIt = clusters.end();
+    QList<QList<ImageData::colorStat>::iterator> itemsToDelete;
+    while (sourceIt != clusters.begin()) {
+        sourceIt--;
+        for (auto destIt = clusters.begin(); destIt != clusters.end() && destIt != sourceIt; destIt++) {
+            if (squareDistance((*sourceIt).centroid, (*destIt).centroid) < s_minimumSquareDistance) {
+                const qreal ratio = (*sourceIt).ratio / (*destIt).ratio;
+                const int r = ratio * qreal(qRed((*sourceIt).centroid)) + (1 - ratio) * qreal(qRed((*destIt).centroid));
+                const int g = ratio * qreal(qGreen((*sourceIt).centroid)) + (1 - ratio) * qreal(qGreen((*destIt).centroid));
+                const int b = ratio * qreal(qBlue((*sourceIt).centroid)) + (1 - ratio) * qreal(qBlue((*destIt).centroid));
+                (*destIt).ratio += (*sourceIt).ratio;
+                (*destIt).centroid = qRgb(r, g, b);
+                itemsToDelete << sourceIt;
+                break;
+            }
+        }
+    }
+    for (const auto &i : std::as_const(itemsToDelete)) {
+        clusters.erase(i);
+    }
+}
+
+ImageData PaletteGenerator::generatePalette(const QImage &sourceImage, const QList<QRgb> &seeds, int iterations)
+{
+    ImageData imageData;
+
+    if (sourceImage.isNull() || sourceImage.width() == 0) {
+        return imageData;
+    }
+
+    RegionData region = clusterRegion(sourceImage, sourceImage.rect(), seeds, iterations);
+    imageData.m_clusters = region.clusters;
+    imageData.m_samples = region.samples;
+
+    if (imageData.m_samples.isEmpty()) {
+        return imageData;
+    }
+
+    const qint64 c = imageData.m_samples.count();
+    imageData.m_average = QColor(region.red / c, region.green / c, region.blue / c, 255);
+
+    std::sort(imageData.m_clusters.begin(), imageData.m_clusters.end(), [](const ImageData::colorStat &a, const ImageData::colorStat &b) {
+        return a.colors.size() > b.colors.size();
+    });
+
+    compressClusters(imageData.m_clusters);
+    fillPalette(imageData);
+
+    return imageData;
+}
+
+ImageData PaletteGenerator::generatePaletteTiled(const QImage &sourceImage, const QList<QRgb> &seeds, int iterations)
+{
+    ImageData imageData;
+
+    if (sourceImage.isNull() || sourceImage.width() == 0) {
+        return imageData;
+    }
+
+    // A fixed grid rather than one tile per thread, so the result does not
+    // depend on the machine.
+    QVector<QRect> tiles;
+    for (int y = 0; y < sourceImage.height(); y += s_tileSize) {
+        for (int x = 0; x < sourceImage.width(); x += s_tileSize) {
+            tiles << QRect(x, y, s_tileSize, s_tileSize).intersected(sourceImage.rect());
+        }
+    }
+
+    // Only the sums and the size of each cluster are kept of a tile, holding
+    // on to its samples until all tiles are done would copy the whole image.
+    struct TileData {
+        qint64 red = 0;
+        qint64 green = 0;
+        qint64 blue = 0;
+        qint64 sampleCount = 0;
+        QVector<QPair<QRgb, qint64>> clusters;
+    };
+
+    const auto regions = QtConcurrent::blockingMapped<QVector<TileData>>(tiles, [&sourceImage, &seeds, iterations](const QRect &tile) {
+        const RegionData region = clusterRegion(sourceImage, tile, seeds, iterations);
+
+        TileData data;
+        data.red = region.red;
+        data.green = region.green;
+        data.blue = region.blue;
+        data.sampleCount = region.samples.count();
+        data.clusters.reserve(region.clusters.count());
+        for (const auto &stat : region.clusters) {
+            data.clusters << qMakePair(stat.centroid, qint64(stat.colors.size()));
+        }
+        return data;
+    });
+
+    // Merge the clusters of all tiles, weighted by the number of samples
+    // they got in the last pass.
+    struct MergedCluster {
+        qint64 red = 0;
+        qint64 green = 0;
+        qint64 blue = 0;
+        qint64 count = 0;
+        QRgb centroid = 0;
+    };
+    QVector<MergedCluster> merged;
+    qint64 red = 0;
+    qint64 green = 0;
+    qint64 blue = 0;
+    qint64 sampleCount = 0;
+
+    for (const auto &region : regions) {
+        red += region.red;
+        green += region.green;
+        blue += region.blue;
+        sampleCount += region.sampleCount;
+
+        for (const auto &cluster : region.clusters) {
+            const QRgb centroid = cluster.first;
+            const qint64 weight = cluster.second;
+            auto itr = std::find_if(merged.begin(), merged.end(), [centroid](const MergedCluster &mergedCluster) {
+                return squareDistance(centroid, mergedCluster.centroid) < s_minimumSquareDistance;
+            });
+            if (itr == merged.end()) {
+                itr = merged.insert(merged.end(), MergedCluster{});
+            }
+            itr->red += qRed(centroid) * weight;
+            itr->green += qGreen(centroid) * weight;
+            itr->blue += qBlue(centroid) * weight;
+            itr->count += weight;
+            itr->centroid = qRgb(itr->red / itr->count, itr->green / itr->count, itr->blue / itr->count);
+        }
+    }
+
+    if (sampleCount == 0) {
+        return imageData;
+    }
+
+    imageData.m_average = QColor(red / sampleCount, green / sampleCount, blue / sampleCount, 255);
+
+    qint64 totalWeight = 0;
+    for (const auto &cluster : std::as_const(merged)) {
+        totalWeight += cluster.count;
+    }
+    for (const auto &cluster : std::as_const(merged)) {
+        ImageData::colorStat stat;
+        stat.centroid = cluster.centroid;
+        stat.ratio = qreal(cluster.count) / qreal(totalWeight);
+        imageData.m_clusters << stat;
+    }
+
+    std::sort(imageData.m_clusters.begin(), imageData.m_clusters.end(), [](const ImageData::colorStat &a, const ImageData::colorStat &b) {
+        return a.ratio > b.ratio;
+    });
+
+    compressClusters(imageData.m_clusters);
+    fillPalette(imageData);
+
+    return imageData;
+}
+
+void PaletteGenerator::fillPalette(ImageData &imageData)
+{
+    imageData.m_highlight = QColor();
+    imageData.m_dominant = QColor(imageData.m_clusters.first().centroid);
+    imageData.m_closestToBlack = Qt::white;
+    imageData.m_closestToWhite = Qt::black;
+
+    imageData.m_palette.clear();
+
+    bool first = true;
+
+    for (const auto &stat : std::as_const(imageData.m_clusters)) {
+        QVariantMap entry;
+        const QColor color(stat.centroid);
+        entry[QStringLiteral("color")] = color;
+        entry[QStringLiteral("ratio")] = stat.ratio;
+
+        QColor contrast = QColor(255 - color.red(), 255 - color.green(), 255 - color.blue());
+        contrast.setHsl(contrast.hslHue(), //
+                        contrast.hslSaturation(), //
+                        128 + (128 - contrast.lightness()));
+        QColor tempContrast;
+        int minimumDistance = 4681800; // max distance: 4*3*2*3*255*255
+        for (const auto &stat : std::as_const(imageData.m_clusters)) {
+            const int distance = squareDistance(contrast.rgb(), stat.centroid);
+
+            if (distance < minimumDistance) {
+                tempContrast = QColor(stat.centroid);
+                minimumDistance = distance;
+            }
+        }
+
+        if (imageData.m_clusters.size() <= 3) {
+            if (qGray(imageData.m_dominant.rgb()) < 120) {
+                contrast = QColor(230, 230, 230);
+            } else {
+                contrast = QColor(20, 20, 20);
+            }
+            // TODO: replace m_clusters.size() > 3 with entropy calculation
+        } else if (squareDistance(contrast.rgb(), tempContrast.rgb()) < s_minimumSquareDistance * 1.5) {
+            contrast = tempContrast;
+        } else {
+            contrast = tempContrast;
+            contrast.setHsl(contrast.hslHue(),
+                            contrast.hslSaturation(),
+                            contrast.lightness() > 128 ? qMin(contrast.lightness() + 20, 255) : qMax(0, contrast.lightness() - 20));
+        }
+
+        entry[QStringLiteral("contrastColor")] = contrast;
+
+        if (first) {
+            imageData.m_dominantContrast = contrast;
+            imageData.m_dominant = color;
+        }
+        first = false;
+
+        if (!imageData.m_highlight.isValid() || ColorUtils::chroma(color) > ColorUtils::chroma(imageData.m_highlight)) {
+            imageData.m_highlight = color;
+        }
+
+        if (qGray(color.rgb()) > qGray(imageData.m_closestToWhite.rgb())) {
+            imageData.m_closestToWhite = color;
+        }
+        if (qGray(color.rgb()) < qGray(imageData.m_closestToBlack.rgb())) {
+            imageData.m_closestToBlack = color;
+        }
+        imageData.m_palette << entry;
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2020 Marco Martin <mart@kde.org>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  2.010-1301, USA.
+ */
+
+#pragma once
+
+#include <QColor>
+#include <QImage>
+#include <QList>
+#include <QRect>
+#include <QVariantList>
+
+struct ImageData {
+    struct colorStat {
+        QList<QRgb> colors;
+        QRgb centroid = 0;
+        qreal ratio = 0;
+    };
+
+    struct colorSet {
+        QColor average;
+        QColor text;
+        QColor background;
+        QColor highlight;
+    };
+
+    QList<QRgb> m_samples;
+    QList<colorStat> m_clusters;
+    QVariantList m_palette;
+
+    bool m_darkPalette = true;
+    QColor m_dominant;
+    QColor m_dominantContrast;
+    QColor m_average;
+    QColor m_highlight;
+
+    QColor m_closestToBlack;
+    QColor m_closestToWhite;
+};
+
+/**
+ * Extracts a color palette from an image.
+ *
+ * This doesn't depend on QObject or on a QML engine, so it can be used from
+ * worker threads as well as from command line tools such as
+ * kirigami-palette-indexer.
+ *
+ * \sa ImageColors
+ */
+class PaletteGenerator
+{
+public:
+    /**
+     * Computes the palette of \p sourceImage.
+     *
+     * Colors are grouped with k-means clustering, running at most
+     * \p iterations passes. When \p seeds is not empty, those colors are
+     * used as initial centroids, which converges faster when the image is
+     * similar to the one the seeds come from.
+     */
+    static ImageData generatePalette(const QImage &sourceImage, const QList<QRgb> &seeds = {}, int iterations = 5);
+
+    /**
+     * Computes the palette of \p sourceImage, clustering tiles of the image in
+     * parallel on the global thread pool.
+     *
+     * Each tile of s_tileSize pixels is clustered on its own, then the
+     * clusters of all tiles are merged and compressed the same way the
+     * clusters of generatePalette() are. The average color is the same as the
+     * one of generatePalette(); clusters closer than s_minimumSquareDistance
+     * end up merged, so palette colors can differ from the ones of
+     * generatePalette() by up to that distance, and their ratios differ
+     * accordingly. The samples of the image are not kept in the result.
+     *
+     * This is only worth it for large images, see s_tiledMinimumPixels.
+     */
+    static ImageData generatePaletteTiled(const QImage &sourceImage, const QList<QRgb> &seeds = {}, int iterations = 5);
+
+    /**
+     * Weighted RGB distance between two colors, used to decide whether two
+     * colors belong to the same cluster.
+     */
+    static int squareDistance(QRgb color1, QRgb color2);
+
+    // Arbitrary number that seems to work well
+    static const int s_minimumSquareDistance = 32000;
+
+    // Edge length of the tiles used by generatePaletteTiled()
+    static const int s_tileSize = 256;
+    // Images with fewer pixels are faster to process in one go
+    static const int s_tiledMinimumPixels = 512 * 512;
+
+private:
+    struct RegionData {
+        QList<QRgb> samples;
+        QList<ImageData::colorStat> clusters;
+        qint64 red = 0;
+        qint64 green = 0;
+        qint64 blue = 0;
+    };
+
+    static inline void positionColor(QRgb rgb, QList<ImageData::colorStat> &clusters);
+    static RegionData clusterRegion(const QImage &sourceImage, const QRect &rect, const QList<QRgb> &seeds, int iterations);
+    static void compressClusters(QList<ImageData::colorStat> &clusters);
+    static void fillPalette(ImageData &imageData);
+};
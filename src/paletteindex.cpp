@@ -0,0 +1,306 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "paletteindex.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QSaveFile>
+#include <QVariantMap>
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+
+#include "loggingcategory.h"
+
+namespace
+{
+const char s_magic[4] = {'K', 'P', 'A', 'L'};
+const quint32 s_version = 1;
+
+const int s_headerSize = 16;
+const int s_entrySize = 56;
+const int s_colorSize = 12;
+
+// Offsets of the fields inside an entry
+enum EntryField {
+    PathHash = 0,
+    ContentHash = 8,
+    PathOffset = 16,
+    PathLength = 20,
+    FirstColor = 24,
+    ColorCount = 28,
+    Average = 32,
+    Dominant = 36,
+    DominantContrast = 40,
+    Highlight = 44,
+    ClosestToBlack = 48,
+    ClosestToWhite = 52,
+};
+
+QMutex s_indexesMutex;
+QHash<QString, std::weak_ptr<PaletteIndex>> s_indexes;
+
+template<typename T>
+inline T readValue(const uchar *data, int offset)
+{
+    return qFromLittleEndian<T>(data + offset);
+}
+
+template<typename T>
+inline void appendValue(QByteArray &data, T value)
+{
+    const T littleEndian = qToLittleEndian(value);
+    data.append(reinterpret_cast<const char *>(&littleEndian), sizeof(T));
+}
+
+inline quint32 floatBits(float value)
+{
+    quint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float bitsFloat(quint32 bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+}
+
+PaletteIndex::~PaletteIndex()
+{
+    if (m_data) {
+        m_file.unmap(const_cast<uchar *>(m_data));
+    }
+}
+
+std::shared_ptr<PaletteIndex> PaletteIndex::open(const QString &fileName)
+{
+    QMutexLocker locker(&s_indexesMutex);
+
+    auto existing = s_indexes.value(fileName).lock();
+    if (existing) {
+        return existing;
+    }
+
+    std::shared_ptr<PaletteIndex> index(new PaletteIndex);
+    index->m_file.setFileName(fileName);
+    if (!index->m_file.open(QIODevice::ReadOnly)) {
+        qCWarning(KirigamiLog) << "Could not open palette index" << fileName;
+        return nullptr;
+    }
+
+    index->m_size = index->m_file.size();
+    if (index->m_size < s_headerSize) {
+        qCWarning(KirigamiLog) << "Invalid palette index" << fileName;
+        return nullptr;
+    }
+
+    index->m_data = index->m_file.map(0, index->m_size);
+    if (!index->m_data) {
+        qCWarning(KirigamiLog) << "Could not map palette index" << fileName;
+        return nullptr;
+    }
+
+    if (std::memcmp(index->m_data, s_magic, sizeof(s_magic)) != 0 || readValue<quint32>(index->m_data, 4) != s_version) {
+        qCWarning(KirigamiLog) << "Unsupported palette index" << fileName;
+        return nullptr;
+    }
+
+    index->m_count = readValue<quint32>(index->m_data, 8);
+    const quint32 colorCount = readValue<quint32>(index->m_data, 12);
+    if (s_headerSize + qint64(index->m_count) * s_entrySize + qint64(colorCount) * s_colorSize > index->m_size) {
+        qCWarning(KirigamiLog) << "Truncated palette index" << fileName;
+        return nullptr;
+    }
+
+    s_indexes.insert(fileName, index);
+    return index;
+}
+
+bool PaletteIndex::write(const QString &fileName, QVector<Entry> entries)
+{
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+        return hashPath(a.path) < hashPath(b.path);
+    });
+
+    QByteArray entryData;
+    QByteArray colorData;
+    QByteArray pathData;
+    entryData.reserve(entries.size() * s_entrySize);
+
+    quint32 colorCount = 0;
+    for (const auto &entry : std::as_const(entries)) {
+        const QByteArray path = entry.path.toUtf8();
+        const auto &imageData = entry.imageData;
+
+        appendValue<quint64>(entryData, hashPath(entry.path));
+        appendValue<quint64>(entryData, entry.contentHash);
+        appendValue<quint32>(entryData, pathData.size());
+        appendValue<quint32>(entryData, path.size());
+        appendValue<quint32>(entryData, colorCount);
+        appendValue<quint32>(entryData, imageData.m_palette.size());
+        appendValue<quint32>(entryData, imageData.m_average.rgba());
+        appendValue<quint32>(entryData, imageData.m_dominant.rgba());
+        appendValue<quint32>(entryData, imageData.m_dominantContrast.rgba());
+        appendValue<quint32>(entryData, imageData.m_highlight.rgba());
+        appendValue<quint32>(entryData, imageData.m_closestToBlack.rgba());
+        appendValue<quint32>(entryData, imageData.m_closestToWhite.rgba());
+
+        for (const auto &paletteEntry : imageData.m_palette) {
+            const auto map = paletteEntry.toMap();
+            appendValue<quint32>(colorData, map.value(QStringLiteral("color")).value<QColor>().rgba());
+            appendValue<quint32>(colorData, map.value(QStringLiteral("contrastColor")).value<QColor>().rgba());
+            appendValue<quint32>(colorData, floatBits(map.value(QStringLiteral("ratio")).toFloat()));
+        }
+        colorCount += imageData.m_palette.size();
+
+        pathData.append(path);
+    }
+
+    QByteArray header;
+    header.append(s_magic, sizeof(s_magic));
+    appendValue<quint32>(header, s_version);
+    appendValue<quint32>(header, entries.size());
+    appendValue<quint32>(header, colorCount);
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(header);
+    file.write(entryData);
+    file.write(colorData);
+    file.write(pathData);
+    return file.commit();
+}
+
+const uchar *PaletteIndex::findEntry(const QString &path) const
+{
+    const quint64 pathHash = hashPath(path);
+    const QByteArray pathUtf8 = path.toUtf8();
+
+    const uchar *entries = m_data + s_headerSize;
+    const uchar *strings = entries + qint64(m_count) * s_entrySize + qint64(readValue<quint32>(m_data, 12)) * s_colorSize;
+
+    // Binary search on the path hash, entries are sorted by it
+    quint32 first = 0;
+    quint32 count = m_count;
+    while (count > 0) {
+        const quint32 step = count / 2;
+        if (readValue<quint64>(entries + qint64(first + step) * s_entrySize, PathHash) < pathHash) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+
+    for (; first < m_count; ++first) {
+        const uchar *entry = entries + qint64(first) * s_entrySize;
+        if (readValue<quint64>(entry, PathHash) != pathHash) {
+            break;
+        }
+
+        const quint32 offset = readValue<quint32>(entry, PathOffset);
+        const quint32 length = readValue<quint32>(entry, PathLength);
+        if (qint64(offset) + length > m_size - (strings - m_data)) {
+            break;
+        }
+        if (length == quint32(pathUtf8.size()) && std::memcmp(strings + offset, pathUtf8.constData(), length) == 0) {
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+bool PaletteIndex::contains(const QString &path) const
+{
+    return findEntry(path) != nullptr;
+}
+
+bool PaletteIndex::lookup(const QString &path, quint64 contentHash, ImageData &imageData) const
+{
+    const uchar *entry = findEntry(path);
+    if (!entry || readValue<quint64>(entry, ContentHash) != contentHash) {
+        return false;
+    }
+
+    const uchar *colors = m_data + s_headerSize + qint64(m_count) * s_entrySize;
+    const quint32 firstColor = readValue<quint32>(entry, FirstColor);
+    const quint32 colorCount = readValue<quint32>(entry, ColorCount);
+    if (colorCount == 0 || qint64(firstColor) + colorCount > readValue<quint32>(m_data, 12)) {
+        return false;
+    }
+
+    ImageData data;
+    data.m_average = QColor::fromRgba(readValue<quint32>(entry, Average));
+    data.m_dominant = QColor::fromRgba(readValue<quint32>(entry, Dominant));
+    data.m_dominantContrast = QColor::fromRgba(readValue<quint32>(entry, DominantContrast));
+    data.m_highlight = QColor::fromRgba(readValue<quint32>(entry, Highlight));
+    data.m_closestToBlack = QColor::fromRgba(readValue<quint32>(entry, ClosestToBlack));
+    data.m_closestToWhite = QColor::fromRgba(readValue<quint32>(entry, ClosestToWhite));
+
+    for (quint32 i = firstColor; i < firstColor + colorCount; ++i) {
+        const uchar *color = colors + qint64(i) * s_colorSize;
+
+        ImageData::colorStat stat;
+        stat.centroid = readValue<quint32>(color, 0);
+        stat.ratio = bitsFloat(readValue<quint32>(color, 8));
+        data.m_clusters << stat;
+
+        QVariantMap paletteEntry;
+        paletteEntry[QStringLiteral("color")] = QColor::fromRgba(stat.centroid);
+        paletteEntry[QStringLiteral("ratio")] = stat.ratio;
+        paletteEntry[QStringLiteral("contrastColor")] = QColor::fromRgba(readValue<quint32>(color, 4));
+        data.m_palette << paletteEntry;
+    }
+
+    imageData = data;
+    return true;
+}
+
+quint64 PaletteIndex::hashPath(const QString &path)
+{
+    return hashContent(path.toUtf8());
+}
+
+// 64 bit FNV-1a, these hashes need to be stable across runs and machines
+static quint64 fnv1a(quint64 hash, const char *data, qint64 size)
+{
+    for (qint64 i = 0; i < size; ++i) {
+        hash ^= uchar(data[i]);
+        hash *= Q_UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+static const quint64 s_fnvOffsetBasis = Q_UINT64_C(0xcbf29ce484222325);
+
+quint64 PaletteIndex::hashContent(const QByteArray &data)
+{
+    return fnv1a(s_fnvOffsetBasis, data.constData(), data.size());
+}
+
+quint64 PaletteIndex::hashFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+
+    quint64 hash = s_fnvOffsetBasis;
+    char buffer[64 * 1024];
+    qint64 read = 0;
+    while ((read = file.read(buffer, sizeof(buffer))) > 0) {
+        hash = fnv1a(hash, buffer, read);
+    }
+    return hash;
+}
@@ -0,0 +1,84 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+
+#include <memory>
+
+#include "palettegenerator.h"
+
+/**
+ * A precomputed set of palettes, as written by kirigami-palette-indexer.
+ *
+ * The index is a single binary file which is memory mapped when opened, so a
+ * lookup doesn't need to parse or copy anything but the entry it returns.
+ * Entries are keyed by the absolute path of the image, and store a hash of
+ * the content of the file so stale entries are never used.
+ *
+ * All values are stored little endian. The file is laid out as:
+ * * a header: the "KPAL" magic, the format version and the amount of entries
+ * * the entries, sorted by path hash, each holding the hashes, the location
+ *   of its path and palette and the main colors of the image
+ * * the palette colors of all entries
+ * * the UTF-8 encoded paths of all entries
+ *
+ * \sa ImageColors::paletteIndex
+ */
+class PaletteIndex
+{
+public:
+    struct Entry {
+        QString path;
+        quint64 contentHash = 0;
+        ImageData imageData;
+    };
+
+    ~PaletteIndex();
+
+    /**
+     * Opens the index stored in \p fileName.
+     *
+     * Indexes are shared: opening the same file again returns the same
+     * instance as long as it's in use. Returns nullptr if the file is not a
+     * valid index.
+     */
+    static std::shared_ptr<PaletteIndex> open(const QString &fileName);
+
+    /**
+     * Writes \p entries to \p fileName, replacing any existing file.
+     */
+    static bool write(const QString &fileName, QVector<Entry> entries);
+
+    /**
+     * Looks up the palette of the image at \p path.
+     *
+     * Returns false if the image is not in the index or if \p contentHash
+     * doesn't match the one stored, in which case \p imageData is untouched.
+     */
+    bool lookup(const QString &path, quint64 contentHash, ImageData &imageData) const;
+
+    /**
+     * Whether the index has any entry for \p path, regardless of its content.
+     */
+    bool contains(const QString &path) const;
+
+    static quint64 hashPath(const QString &path);
+    static quint64 hashContent(const QByteArray &data);
+    static quint64 hashFile(const QString &fileName);
+
+private:
+    PaletteIndex() = default;
+    const uchar *findEntry(const QString &path) const;
+
+    QFile m_file;
+    const uchar *m_data = nullptr;
+    qint64 m_size = 0;
+    quint32 m_count = 0;
+};
@@ -0,0 +1,234 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "passivenotificationmodel.h"
+
+#include <limits>
+
+#include "loggingcategory.h"
+
+PassiveNotificationModel::PassiveNotificationModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+    m_clock.start();
+
+    m_expiryTimer.setSingleShot(true);
+    connect(&m_expiryTimer, &QTimer::timeout, this, &PassiveNotificationModel::expire);
+}
+
+PassiveNotificationModel::~PassiveNotificationModel()
+{
+}
+
+int PassiveNotificationModel::maximumCount() const
+{
+    return m_maximumCount;
+}
+
+void PassiveNotificationModel::setMaximumCount(int count)
+{
+    count = qMax(count, 1);
+    if (count == m_maximumCount) {
+        return;
+    }
+
+    m_maximumCount = count;
+    if (m_notifications.size() > m_maximumCount) {
+        beginRemoveRows(QModelIndex(), m_maximumCount, m_notifications.size() - 1);
+        m_notifications.resize(m_maximumCount);
+        endRemoveRows();
+        Q_EMIT countChanged();
+        scheduleExpiry();
+    }
+    Q_EMIT maximumCountChanged();
+}
+
+bool PassiveNotificationModel::isPaused() const
+{
+    return m_paused;
+}
+
+void PassiveNotificationModel::setPaused(bool paused)
+{
+    if (paused == m_paused) {
+        return;
+    }
+
+    if (paused) {
+        m_activeOffset += m_clock.elapsed();
+        m_expiryTimer.stop();
+    } else {
+        m_clock.restart();
+    }
+
+    m_paused = paused;
+    scheduleExpiry();
+    Q_EMIT pausedChanged();
+}
+
+int PassiveNotificationModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_notifications.size();
+}
+
+QVariant PassiveNotificationModel::data(const QModelIndex &index, int role) const
+{
+    if (!checkIndex(index, CheckIndexOption::IndexIsValid)) {
+        return QVariant();
+    }
+
+    const auto &notification = m_notifications.at(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+    case TextRole:
+        return notification.text;
+    case ActionTextRole:
+        return notification.actionText;
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> PassiveNotificationModel::roleNames() const
+{
+    return {
+        {TextRole, "text"},
+        {ActionTextRole, "actionText"},
+    };
+}
+
+void PassiveNotificationModel::post(const QString &message, int timeout, const QString &actionText, const QJSValue &callback)
+{
+    if (message.isEmpty()) {
+        return;
+    }
+
+    const qint64 expiresAt = activeTime() + qMax(timeout, 0);
+
+    // Coalesce with an identical notification that is still shown, so a
+    // burst of the same message results in a single notification.
+    for (int i = 0; i < m_notifications.size(); ++i) {
+        auto &notification = m_notifications[i];
+        if (notification.text != message || notification.actionText != actionText) {
+            continue;
+        }
+
+        notification.expiresAt = qMax(notification.expiresAt, expiresAt);
+        notification.callback = callback;
+        if (i > 0) {
+            beginMoveRows(QModelIndex(), i, i, QModelIndex(), 0);
+            m_notifications.move(i, 0);
+            endMoveRows();
+        }
+        scheduleExpiry();
+        return;
+    }
+
+    // Drop the oldest notifications to make room for the new one.
+    if (m_notifications.size() >= m_maximumCount) {
+        beginRemoveRows(QModelIndex(), m_maximumCount - 1, m_notifications.size() - 1);
+        m_notifications.resize(m_maximumCount - 1);
+        endRemoveRows();
+    }
+
+    beginInsertRows(QModelIndex(), 0, 0);
+    m_notifications.prepend(Notification{message, actionText, callback, expiresAt});
+    endInsertRows();
+
+    scheduleExpiry();
+    Q_EMIT countChanged();
+}
+
+void PassiveNotificationModel::trigger(int index)
+{
+    if (index < 0 || index >= m_notifications.size()) {
+        return;
+    }
+
+    auto callback = m_notifications.at(index).callback;
+    remove(index);
+
+    if (callback.isCallable()) {
+        const auto result = callback.call();
+        if (result.isError()) {
+            qCWarning(KirigamiLog) << "Error calling passive notification callback:" << result.toString();
+        }
+    }
+}
+
+void PassiveNotificationModel::remove(int index)
+{
+    if (index < 0 || index >= m_notifications.size()) {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), index, index);
+    m_notifications.remove(index);
+    endRemoveRows();
+
+    scheduleExpiry();
+    Q_EMIT countChanged();
+}
+
+void PassiveNotificationModel::clear()
+{
+    if (m_notifications.isEmpty()) {
+        return;
+    }
+
+    beginResetModel();
+    m_notifications.clear();
+    endResetModel();
+
+    m_expiryTimer.stop();
+    Q_EMIT countChanged();
+}
+
+qint64 PassiveNotificationModel::activeTime() const
+{
+    return m_paused ? m_activeOffset : m_activeOffset + m_clock.elapsed();
+}
+
+void PassiveNotificationModel::scheduleExpiry()
+{
+    if (m_paused || m_notifications.isEmpty()) {
+        m_expiryTimer.stop();
+        return;
+    }
+
+    qint64 next = std::numeric_limits<qint64>::max();
+    for (const auto &notification : std::as_const(m_notifications)) {
+        next = qMin(next, notification.expiresAt);
+    }
+
+    m_expiryTimer.start(int(qBound<qint64>(0, next - activeTime(), std::numeric_limits<int>::max())));
+}
+
+void PassiveNotificationModel::expire()
+{
+    const qint64 now = activeTime();
+
+    // Walk backwards so each removal only affects rows already visited.
+    bool removed = false;
+    for (int i = m_notifications.size() - 1; i >= 0; --i) {
+        if (m_notifications.at(i).expiresAt <= now) {
+            beginRemoveRows(QModelIndex(), i, i);
+            m_notifications.remove(i);
+            endRemoveRows();
+            removed = true;
+        }
+    }
+
+    scheduleExpiry();
+    if (removed) {
+        Q_EMIT countChanged();
+    }
+}
+
+#include "moc_passivenotificationmodel.cpp"
@@ -0,0 +1,114 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QAbstractListModel>
+#include <QElapsedTimer>
+#include <QJSValue>
+#include <QTimer>
+#include <QVector>
+
+/**
+ * The queue of passive notifications currently shown.
+ *
+ * The newest notification is the first row. All notifications expire from
+ * a single shared timer, which can be paused, for example while the user
+ * hovers the notifications. Posting a notification identical to one already
+ * shown does not add a row, it moves the existing one to the top and extends
+ * its timeout instead.
+ */
+class PassiveNotificationModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    /**
+     * The maximum number of notifications shown at once. When a new
+     * notification is posted, the oldest ones are removed to stay within it.
+     */
+    Q_PROPERTY(int maximumCount READ maximumCount WRITE setMaximumCount NOTIFY maximumCountChanged)
+
+    /**
+     * While paused, notifications do not expire.
+     */
+    Q_PROPERTY(bool paused READ isPaused WRITE setPaused NOTIFY pausedChanged)
+
+    /**
+     * The number of notifications currently shown.
+     */
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+public:
+    enum Roles {
+        TextRole = Qt::UserRole + 1,
+        ActionTextRole,
+    };
+    Q_ENUM(Roles)
+
+    explicit PassiveNotificationModel(QObject *parent = nullptr);
+    ~PassiveNotificationModel() override;
+
+    int maximumCount() const;
+    void setMaximumCount(int count);
+
+    bool isPaused() const;
+    void setPaused(bool paused);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    /**
+     * Show @p message for @p timeout milliseconds.
+     *
+     * @p actionText is the text of an optional button, @p callback is called
+     * when it is clicked.
+     */
+    Q_INVOKABLE void post(const QString &message, int timeout, const QString &actionText = QString(), const QJSValue &callback = QJSValue());
+
+    /**
+     * Call the callback of the notification at @p index, then remove it.
+     */
+    Q_INVOKABLE void trigger(int index);
+
+    /**
+     * Remove the notification at @p index.
+     */
+    Q_INVOKABLE void remove(int index);
+
+    /**
+     * Remove all notifications.
+     */
+    Q_INVOKABLE void clear();
+
+Q_SIGNALS:
+    void maximumCountChanged();
+    void pausedChanged();
+    void countChanged();
+
+private:
+    struct Notification {
+        QString text;
+        QString actionText;
+        QJSValue callback;
+        // In milliseconds of unpaused time, see activeTime().
+        qint64 expiresAt = 0;
+    };
+
+    qint64 activeTime() const;
+    void scheduleExpiry();
+    void expire();
+
+    QVector<Notification> m_notifications;
+    int m_maximumCount = 3;
+    bool m_paused = false;
+
+    // Time spent unpaused is m_activeOffset plus, while running, the time
+    // since m_clock was started.
+    QElapsedTimer m_clock;
+    qint64 m_activeOffset = 0;
+    QTimer m_expiryTimer;
+};
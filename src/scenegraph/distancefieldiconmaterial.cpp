@@ -0,0 +1,91 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "distancefieldiconmaterial.h"
+
+#include <QOpenGLContext>
+
+QSGMaterialType DistanceFieldIconMaterial::staticType;
+
+DistanceFieldIconMaterial::DistanceFieldIconMaterial()
+{
+    setFlag(QSGMaterial::Blending, true);
+}
+
+QSGMaterialShader *DistanceFieldIconMaterial::createShader() const
+{
+    return new DistanceFieldIconShader{};
+}
+
+QSGMaterialType *DistanceFieldIconMaterial::type() const
+{
+    return &staticType;
+}
+
+int DistanceFieldIconMaterial::compare(const QSGMaterial *other) const
+{
+    auto material = static_cast<const DistanceFieldIconMaterial *>(other);
+    /* clang-format off */
+    if (material->textureSource == textureSource
+        && material->color == color
+        && qFuzzyCompare(material->smoothing, smoothing)) { /* clang-format on */
+        return 0;
+    }
+
+    return QSGMaterial::compare(other);
+}
+
+DistanceFieldIconShader::DistanceFieldIconShader()
+{
+    auto header = QOpenGLContext::currentContext()->isOpenGLES() ? QStringLiteral("header_es.glsl") : QStringLiteral("header_desktop.glsl");
+
+    auto shaderRoot = QStringLiteral(":/org/kde/kirigami/shaders/");
+
+    setShaderSourceFiles(QOpenGLShader::Vertex, {shaderRoot + header, shaderRoot + QStringLiteral("distancefieldicon.vert")});
+    setShaderSourceFiles(QOpenGLShader::Fragment, {shaderRoot + header, shaderRoot + QStringLiteral("distancefieldicon.frag")});
+}
+
+const char *const *DistanceFieldIconShader::attributeNames() const
+{
+    static char const *const names[] = {"in_vertex", "in_uv", nullptr};
+    return names;
+}
+
+void DistanceFieldIconShader::initialize()
+{
+    QSGMaterialShader::initialize();
+    m_matrixLocation = program()->uniformLocation("matrix");
+    m_opacityLocation = program()->uniformLocation("opacity");
+    m_colorLocation = program()->uniformLocation("color");
+    m_smoothingLocation = program()->uniformLocation("smoothing");
+    program()->setUniformValue("textureSource", 0);
+}
+
+void DistanceFieldIconShader::updateState(const QSGMaterialShader::RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial)
+{
+    auto p = program();
+
+    if (state.isMatrixDirty()) {
+        p->setUniformValue(m_matrixLocation, state.combinedMatrix());
+    }
+
+    if (state.isOpacityDirty()) {
+        p->setUniformValue(m_opacityLocation, state.opacity());
+    }
+
+    auto material = static_cast<DistanceFieldIconMaterial *>(newMaterial);
+    if (!oldMaterial || newMaterial->compare(oldMaterial) != 0 || state.isCachedMaterialDataDirty()) {
+        p->setUniformValue(m_colorLocation, material->color);
+        p->setUniformValue(m_smoothingLocation, material->smoothing);
+    }
+
+    if (material->textureSource) {
+        // The field is sampled between texels, nearest filtering would make
+        // the outline blocky.
+        material->textureSource->setFiltering(QSGTexture::Linear);
+        material->textureSource->bind();
+    }
+}
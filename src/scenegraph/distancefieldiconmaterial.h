@@ -0,0 +1,57 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QColor>
+#include <QSGMaterial>
+#include <QSGMaterialShader>
+#include <QSGTexture>
+
+/**
+ * A material rendering a monochrome icon from a signed distance field.
+ *
+ * The texture contains the distance to the icon's outline, the shader turns
+ * that into coverage and fills it with a single color. Because the outline is
+ * reconstructed per pixel, the same texture can be drawn crisply at any size.
+ *
+ * \sa IconDistanceField
+ */
+class DistanceFieldIconMaterial : public QSGMaterial
+{
+public:
+    DistanceFieldIconMaterial();
+
+    QSGMaterialShader *createShader() const override;
+    QSGMaterialType *type() const override;
+    int compare(const QSGMaterial *other) const override;
+
+    QSGTexture *textureSource = nullptr;
+    QColor color = Qt::black;
+    /**
+     * Half the width of the anti-aliased edge, in units of the distance field.
+     */
+    float smoothing = 0.05;
+
+    static QSGMaterialType staticType;
+};
+
+class DistanceFieldIconShader : public QSGMaterialShader
+{
+public:
+    DistanceFieldIconShader();
+
+    char const *const *attributeNames() const override;
+
+    void initialize() override;
+    void updateState(const QSGMaterialShader::RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override;
+
+private:
+    int m_matrixLocation = -1;
+    int m_opacityLocation = -1;
+    int m_colorLocation = -1;
+    int m_smoothingLocation = -1;
+};
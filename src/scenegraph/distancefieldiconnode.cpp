@@ -0,0 +1,60 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "distancefieldiconnode.h"
+
+#include "distancefieldiconmaterial.h"
+
+DistanceFieldIconNode::DistanceFieldIconNode()
+{
+    m_geometry = new QSGGeometry{QSGGeometry::defaultAttributes_TexturedPoint2D(), 4};
+    setGeometry(m_geometry);
+    setFlag(QSGNode::OwnsGeometry);
+
+    m_material = new DistanceFieldIconMaterial{};
+    setMaterial(m_material);
+    setFlag(QSGNode::OwnsMaterial);
+}
+
+void DistanceFieldIconNode::setTexture(QSharedPointer<QSGTexture> texture)
+{
+    m_texture = texture;
+    if (m_material->textureSource != texture.data()) {
+        m_material->textureSource = texture.data();
+        markDirty(QSGNode::DirtyMaterial);
+    }
+}
+
+void DistanceFieldIconNode::setRect(const QRectF &rect)
+{
+    if (rect == m_rect) {
+        return;
+    }
+
+    m_rect = rect;
+    QSGGeometry::updateTexturedRectGeometry(m_geometry, m_rect, QRectF{0.0, 0.0, 1.0, 1.0});
+    markDirty(QSGNode::DirtyGeometry);
+}
+
+void DistanceFieldIconNode::setColor(const QColor &color)
+{
+    auto premultiplied = QColor::fromRgbF(color.redF() * color.alphaF(), //
+                                          color.greenF() * color.alphaF(),
+                                          color.blueF() * color.alphaF(),
+                                          color.alphaF());
+    if (m_material->color != premultiplied) {
+        m_material->color = premultiplied;
+        markDirty(QSGNode::DirtyMaterial);
+    }
+}
+
+void DistanceFieldIconNode::setSmoothing(qreal smoothing)
+{
+    if (!qFuzzyCompare(m_material->smoothing, float(smoothing))) {
+        m_material->smoothing = smoothing;
+        markDirty(QSGNode::DirtyMaterial);
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QColor>
+#include <QSGGeometryNode>
+#include <QSharedPointer>
+
+class DistanceFieldIconMaterial;
+class QSGTexture;
+
+/**
+ * Scene graph node for an icon rendered from a signed distance field.
+ *
+ * The rect is the area covered by the whole texture, including the padding
+ * around the icon. The smoothing should be derived from the scale at which
+ * the field is displayed, so that the edge is about one device pixel wide.
+ *
+ * \sa DistanceFieldIconMaterial
+ */
+class DistanceFieldIconNode : public QSGGeometryNode
+{
+public:
+    DistanceFieldIconNode();
+
+    void setTexture(QSharedPointer<QSGTexture> texture);
+    void setRect(const QRectF &rect);
+    void setColor(const QColor &color);
+    void setSmoothing(qreal smoothing);
+
+private:
+    QSGGeometry *m_geometry;
+    DistanceFieldIconMaterial *m_material;
+    QSharedPointer<QSGTexture> m_texture;
+    QRectF m_rect;
+};
@@ -0,0 +1,89 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "drawerhandleiconmaterial.h"
+
+#include <QOpenGLContext>
+
+QSGMaterialType DrawerHandleIconMaterial::staticType;
+
+DrawerHandleIconMaterial::DrawerHandleIconMaterial()
+{
+    setFlag(QSGMaterial::Blending, true);
+}
+
+QSGMaterialShader *DrawerHandleIconMaterial::createShader() const
+{
+    return new DrawerHandleIconShader{};
+}
+
+QSGMaterialType *DrawerHandleIconMaterial::type() const
+{
+    return &staticType;
+}
+
+int DrawerHandleIconMaterial::compare(const QSGMaterial *other) const
+{
+    auto material = static_cast<const DrawerHandleIconMaterial *>(other);
+    /* clang-format off */
+    if (material->color == color
+        && material->aspect == aspect
+        && material->bars == bars
+        && material->rotations == rotations) { /* clang-format on */
+        return 0;
+    }
+
+    return QSGMaterial::compare(other);
+}
+
+DrawerHandleIconShader::DrawerHandleIconShader()
+{
+    auto header = QOpenGLContext::currentContext()->isOpenGLES() ? QStringLiteral("header_es.glsl") : QStringLiteral("header_desktop.glsl");
+
+    auto shaderRoot = QStringLiteral(":/org/kde/kirigami/shaders/");
+
+    setShaderSourceFiles(QOpenGLShader::Vertex, {shaderRoot + header, shaderRoot + QStringLiteral("shadowedrectangle.vert")});
+    setShaderSourceFiles(QOpenGLShader::Fragment,
+                         {shaderRoot + header, shaderRoot + QStringLiteral("sdf.glsl"), shaderRoot + QStringLiteral("drawerhandleicon.frag")});
+}
+
+const char *const *DrawerHandleIconShader::attributeNames() const
+{
+    static char const *const names[] = {"in_vertex", "in_uv", nullptr};
+    return names;
+}
+
+void DrawerHandleIconShader::initialize()
+{
+    QSGMaterialShader::initialize();
+    m_matrixLocation = program()->uniformLocation("matrix");
+    m_opacityLocation = program()->uniformLocation("opacity");
+    m_aspectLocation = program()->uniformLocation("aspect");
+    m_colorLocation = program()->uniformLocation("color");
+    m_barsLocation = program()->uniformLocation("bars");
+    m_rotationsLocation = program()->uniformLocation("rotations");
+}
+
+void DrawerHandleIconShader::updateState(const QSGMaterialShader::RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial)
+{
+    auto p = program();
+
+    if (state.isMatrixDirty()) {
+        p->setUniformValue(m_matrixLocation, state.combinedMatrix());
+    }
+
+    if (state.isOpacityDirty()) {
+        p->setUniformValue(m_opacityLocation, state.opacity());
+    }
+
+    if (!oldMaterial || newMaterial->compare(oldMaterial) != 0 || state.isCachedMaterialDataDirty()) {
+        auto material = static_cast<DrawerHandleIconMaterial *>(newMaterial);
+        p->setUniformValue(m_aspectLocation, material->aspect);
+        p->setUniformValue(m_colorLocation, material->color);
+        p->setUniformValueArray(m_barsLocation, material->bars.data(), int(material->bars.size()));
+        p->setUniformValueArray(m_rotationsLocation, material->rotations.data(), int(material->rotations.size()));
+    }
+}
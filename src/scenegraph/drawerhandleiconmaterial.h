@@ -0,0 +1,69 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <array>
+
+#include <QColor>
+#include <QSGMaterial>
+#include <QSGMaterialShader>
+#include <QVector2D>
+#include <QVector4D>
+
+/**
+ * A material rendering the three bars of a drawer handle icon.
+ *
+ * Each bar is a rotated rectangle, the shader renders their union using
+ * distance fields, so the icon is anti-aliased at any rotation without
+ * needing an offscreen layer.
+ *
+ * Coordinates are normalized, (0, 0) is the center of the node and a unit
+ * is half of the smallest dimension of the node.
+ *
+ * \sa DrawerHandleIcon
+ */
+class DrawerHandleIconMaterial : public QSGMaterial
+{
+public:
+    DrawerHandleIconMaterial();
+
+    QSGMaterialShader *createShader() const override;
+    QSGMaterialType *type() const override;
+    int compare(const QSGMaterial *other) const override;
+
+    QVector2D aspect = QVector2D{1.0, 1.0};
+    QColor color = Qt::black;
+    /**
+     * Center of each bar in xy, half its length and half its thickness in zw.
+     */
+    std::array<QVector4D, 3> bars;
+    /**
+     * Cosine and sine of the rotation of each bar.
+     */
+    std::array<QVector2D, 3> rotations = {QVector2D{1.0, 0.0}, QVector2D{1.0, 0.0}, QVector2D{1.0, 0.0}};
+
+    static QSGMaterialType staticType;
+};
+
+class DrawerHandleIconShader : public QSGMaterialShader
+{
+public:
+    DrawerHandleIconShader();
+
+    char const *const *attributeNames() const override;
+
+    void initialize() override;
+    void updateState(const QSGMaterialShader::RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override;
+
+private:
+    int m_matrixLocation = -1;
+    int m_opacityLocation = -1;
+    int m_aspectLocation = -1;
+    int m_colorLocation = -1;
+    int m_barsLocation = -1;
+    int m_rotationsLocation = -1;
+};
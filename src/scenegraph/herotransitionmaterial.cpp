@@ -0,0 +1,107 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "herotransitionmaterial.h"
+
+#include <QOpenGLContext>
+#include <QOpenGLFunctions>
+
+QSGMaterialType HeroTransitionMaterial::staticType;
+QSGMaterialType HeroTransitionMaterial::maskedType;
+
+HeroTransitionMaterial::HeroTransitionMaterial()
+{
+    setFlag(QSGMaterial::Blending, true);
+}
+
+QSGMaterialShader *HeroTransitionMaterial::createShader() const
+{
+    return new HeroTransitionShader{maskSource != nullptr};
+}
+
+QSGMaterialType *HeroTransitionMaterial::type() const
+{
+    return maskSource ? &maskedType : &staticType;
+}
+
+int HeroTransitionMaterial::compare(const QSGMaterial *other) const
+{
+    auto material = static_cast<const HeroTransitionMaterial *>(other);
+    /* clang-format off */
+    if (material->textureSource == textureSource
+        && material->maskSource == maskSource
+        && material->aspect == aspect
+        && qFuzzyCompare(material->radius, radius)
+        && qFuzzyCompare(material->fade, fade)) { /* clang-format on */
+        return 0;
+    }
+
+    return QSGMaterial::compare(other);
+}
+
+HeroTransitionShader::HeroTransitionShader(bool masked)
+    : m_masked(masked)
+{
+    auto header = QOpenGLContext::currentContext()->isOpenGLES() ? QStringLiteral("header_es.glsl") : QStringLiteral("header_desktop.glsl");
+
+    auto shaderRoot = QStringLiteral(":/org/kde/kirigami/shaders/");
+
+    setShaderSourceFiles(QOpenGLShader::Vertex, {shaderRoot + header, shaderRoot + QStringLiteral("shadowedrectangle.vert")});
+
+    const auto shaderFile = masked ? QStringLiteral("herotransition_masked.frag") : QStringLiteral("herotransition.frag");
+    setShaderSourceFiles(QOpenGLShader::Fragment, {shaderRoot + header, shaderRoot + QStringLiteral("sdf.glsl"), shaderRoot + shaderFile});
+}
+
+const char *const *HeroTransitionShader::attributeNames() const
+{
+    static char const *const names[] = {"in_vertex", "in_uv", nullptr};
+    return names;
+}
+
+void HeroTransitionShader::initialize()
+{
+    QSGMaterialShader::initialize();
+    m_matrixLocation = program()->uniformLocation("matrix");
+    m_opacityLocation = program()->uniformLocation("opacity");
+    m_aspectLocation = program()->uniformLocation("aspect");
+    m_radiusLocation = program()->uniformLocation("radius");
+    m_fadeLocation = program()->uniformLocation("fade");
+    program()->setUniformValue("textureSource", 0);
+    if (m_masked) {
+        program()->setUniformValue("maskSource", 1);
+    }
+}
+
+void HeroTransitionShader::updateState(const QSGMaterialShader::RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial)
+{
+    auto p = program();
+
+    if (state.isMatrixDirty()) {
+        p->setUniformValue(m_matrixLocation, state.combinedMatrix());
+    }
+
+    if (state.isOpacityDirty()) {
+        p->setUniformValue(m_opacityLocation, state.opacity());
+    }
+
+    auto material = static_cast<HeroTransitionMaterial *>(newMaterial);
+    if (!oldMaterial || newMaterial->compare(oldMaterial) != 0 || state.isCachedMaterialDataDirty()) {
+        p->setUniformValue(m_aspectLocation, material->aspect);
+        p->setUniformValue(m_radiusLocation, material->radius);
+        p->setUniformValue(m_fadeLocation, material->fade);
+    }
+
+    if (m_masked && material->maskSource) {
+        auto functions = QOpenGLContext::currentContext()->functions();
+        functions->glActiveTexture(GL_TEXTURE1);
+        material->maskSource->bind();
+        functions->glActiveTexture(GL_TEXTURE0);
+    }
+
+    if (material->textureSource) {
+        material->textureSource->bind();
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QSGMaterial>
+#include <QSGMaterialShader>
+#include <QSGTexture>
+#include <QVector2D>
+
+/**
+ * A material rendering one side of a hero transition.
+ *
+ * This draws a snapshot texture faded by a factor. The texture is either
+ * clipped to a rounded rectangle, using a distance field, or multiplied
+ * with the alpha of a mask texture.
+ *
+ * \sa HeroTransition
+ */
+class HeroTransitionMaterial : public QSGMaterial
+{
+public:
+    HeroTransitionMaterial();
+
+    QSGMaterialShader *createShader() const override;
+    QSGMaterialType *type() const override;
+    int compare(const QSGMaterial *other) const override;
+
+    QSGTexture *textureSource = nullptr;
+    /**
+     * When set, the alpha of this texture is used as mask instead of radius.
+     */
+    QSGTexture *maskSource = nullptr;
+    QVector2D aspect = QVector2D{1.0, 1.0};
+    /**
+     * Corner radius, in units of half the smallest dimension. 1.0 is a circle
+     * for a square.
+     */
+    float radius = 0.0;
+    float fade = 1.0;
+
+    static QSGMaterialType staticType;
+    static QSGMaterialType maskedType;
+};
+
+class HeroTransitionShader : public QSGMaterialShader
+{
+public:
+    HeroTransitionShader(bool masked);
+
+    char const *const *attributeNames() const override;
+
+    void initialize() override;
+    void updateState(const QSGMaterialShader::RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override;
+
+private:
+    bool m_masked = false;
+    int m_matrixLocation = -1;
+    int m_opacityLocation = -1;
+    int m_aspectLocation = -1;
+    int m_radiusLocation = -1;
+    int m_fadeLocation = -1;
+};
@@ -0,0 +1,142 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "herotransitionnode.h"
+
+#include <QQuickWindow>
+#include <QSGDynamicTexture>
+
+#include "herotransitionmaterial.h"
+
+static QRectF interpolate(const QRectF &from, const QRectF &to, qreal progress)
+{
+    return QRectF{from.x() + (to.x() - from.x()) * progress,
+                  from.y() + (to.y() - from.y()) * progress,
+                  from.width() + (to.width() - from.width()) * progress,
+                  from.height() + (to.height() - from.height()) * progress};
+}
+
+static QSGTexture *updatedTexture(QSGTextureProvider *provider)
+{
+    if (!provider || !provider->texture()) {
+        return nullptr;
+    }
+
+    // Texture coordinates are computed in the shader, so the texture can't be
+    // part of an atlas.
+    auto texture = provider->texture();
+    if (texture->isAtlasTexture()) {
+        texture = texture->removedFromAtlas();
+    }
+    if (auto dynamicTexture = qobject_cast<QSGDynamicTexture *>(texture)) {
+        dynamicTexture->updateTexture();
+    }
+    return texture;
+}
+
+static QSGGeometryNode *createQuad(HeroTransitionMaterial *material)
+{
+    auto node = new QSGGeometryNode{};
+    node->setGeometry(new QSGGeometry{QSGGeometry::defaultAttributes_TexturedPoint2D(), 4});
+    node->setFlag(QSGNode::OwnsGeometry);
+    node->setMaterial(material);
+    node->setFlag(QSGNode::OwnsMaterial);
+    return node;
+}
+
+HeroTransitionNode::HeroTransitionNode()
+{
+    setFlag(QSGNode::UsePreprocess);
+
+    m_sourceMaterial = new HeroTransitionMaterial{};
+    m_sourceNode = createQuad(m_sourceMaterial);
+    appendChildNode(m_sourceNode);
+
+    m_destinationMaterial = new HeroTransitionMaterial{};
+    m_destinationNode = createQuad(m_destinationMaterial);
+    appendChildNode(m_destinationNode);
+}
+
+void HeroTransitionNode::setTextureSources(QSGTextureProvider *source, QSGTextureProvider *destination, QSGTextureProvider *mask)
+{
+    m_source = source;
+    m_destination = destination;
+    m_mask = mask;
+}
+
+void HeroTransitionNode::setRects(const QRectF &sourceRect, const QRectF &destinationRect)
+{
+    m_sourceRect = sourceRect;
+    m_destinationRect = destinationRect;
+}
+
+void HeroTransitionNode::setAnimation(int duration, const QEasingCurve &easing)
+{
+    m_duration = duration;
+    m_easing = easing;
+}
+
+void HeroTransitionNode::start(QQuickWindow *window, int run)
+{
+    m_window = window;
+    m_run = run;
+    m_finished = false;
+    m_timer.invalidate();
+}
+
+void HeroTransitionNode::preprocess()
+{
+    if (!m_timer.isValid()) {
+        m_timer.start();
+    }
+
+    const qreal time = m_duration > 0 ? qMin(qreal(m_timer.elapsed()) / m_duration, 1.0) : 1.0;
+    const qreal progress = m_easing.valueForProgress(time);
+
+    const QRectF rect = interpolate(m_sourceRect, m_destinationRect, progress);
+
+    // The source fades out while moving to the destination.
+    m_sourceMaterial->textureSource = updatedTexture(m_source);
+    m_sourceMaterial->fade = m_sourceMaterial->textureSource ? 1.0 - progress : 0.0;
+    updateQuad(m_sourceNode, rect);
+
+    // The destination fades in along the same path, its mask going from a
+    // circle to a rectangle unless a custom mask was given.
+    m_destinationMaterial->textureSource = updatedTexture(m_destination);
+    m_destinationMaterial->maskSource = updatedTexture(m_mask);
+    m_destinationMaterial->radius = 1.0 - progress;
+    m_destinationMaterial->fade = m_destinationMaterial->textureSource ? progress : 0.0;
+    updateQuad(m_destinationNode, rect);
+
+    m_sourceNode->markDirty(QSGNode::DirtyMaterial);
+    m_destinationNode->markDirty(QSGNode::DirtyMaterial);
+
+    if (time < 1.0) {
+        if (m_window) {
+            // Schedule the next frame from the render thread, without
+            // involving the GUI thread.
+            m_window->update();
+        }
+    } else if (!m_finished) {
+        m_finished = true;
+        Q_EMIT finished(m_run);
+    }
+}
+
+void HeroTransitionNode::updateQuad(QSGGeometryNode *node, const QRectF &rect)
+{
+    QSGGeometry::updateTexturedRectGeometry(node->geometry(), rect, QRectF{0.0, 0.0, 1.0, 1.0});
+    node->markDirty(QSGNode::DirtyGeometry);
+
+    auto material = static_cast<HeroTransitionMaterial *>(node->material());
+    if (rect.width() >= rect.height()) {
+        material->aspect = QVector2D{float(rect.width() / qMax(rect.height(), 1.0)), 1.0};
+    } else {
+        material->aspect = QVector2D{1.0, float(rect.height() / qMax(rect.width(), 1.0))};
+    }
+}
+
+#include "moc_herotransitionnode.cpp"
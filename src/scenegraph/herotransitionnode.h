@@ -0,0 +1,75 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QEasingCurve>
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPointer>
+#include <QSGGeometryNode>
+#include <QSGTextureProvider>
+
+class QQuickWindow;
+class HeroTransitionMaterial;
+
+/**
+ * Scene graph node animating a hero transition.
+ *
+ * The node moves a snapshot of the source from the source rectangle to the
+ * destination rectangle while fading it out, and a snapshot of the
+ * destination along the same path while fading it in. The animation is
+ * advanced in preprocess(), on the render thread, so it keeps running at full
+ * frame rate while the GUI thread is busy.
+ *
+ * finished() is emitted from the render thread once the last frame of the
+ * animation was prepared, so it should be connected with a queued connection.
+ */
+class HeroTransitionNode : public QObject, public QSGNode
+{
+    Q_OBJECT
+
+public:
+    HeroTransitionNode();
+
+    void setTextureSources(QSGTextureProvider *source, QSGTextureProvider *destination, QSGTextureProvider *mask);
+    void setRects(const QRectF &sourceRect, const QRectF &destinationRect);
+    void setAnimation(int duration, const QEasingCurve &easing);
+
+    /**
+     * Restart the animation with the first frame rendered after this call.
+     *
+     * @p run is passed on to finished(), to tell runs apart.
+     */
+    void start(QQuickWindow *window, int run);
+
+    void preprocess() override;
+
+Q_SIGNALS:
+    void finished(int run);
+
+private:
+    void updateQuad(QSGGeometryNode *node, const QRectF &rect);
+
+    QSGGeometryNode *m_sourceNode = nullptr;
+    QSGGeometryNode *m_destinationNode = nullptr;
+    HeroTransitionMaterial *m_sourceMaterial = nullptr;
+    HeroTransitionMaterial *m_destinationMaterial = nullptr;
+
+    QPointer<QSGTextureProvider> m_source;
+    QPointer<QSGTextureProvider> m_destination;
+    QPointer<QSGTextureProvider> m_mask;
+
+    QRectF m_sourceRect;
+    QRectF m_destinationRect;
+    int m_duration = 0;
+    QEasingCurve m_easing;
+
+    QQuickWindow *m_window = nullptr;
+    QElapsedTimer m_timer;
+    int m_run = 0;
+    bool m_finished = true;
+};
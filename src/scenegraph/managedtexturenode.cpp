@@ -8,6 +8,8 @@
 
 #include "managedtexturenode.h"
 
+#include <QThread>
+
 ManagedTextureNode::ManagedTextureNode()
 {
 }
@@ -18,6 +20,15 @@ void ManagedTextureNode::setTexture(QSharedPointer<QSGTexture> texture)
     QSGSimpleTextureNode::setTexture(texture.data());
 }
 
+using WindowTexturesHash = QHash<QQuickWindow *, WindowTextures>;
+
+static WindowTexturesHash::iterator forgetWindow(WindowTexturesHash &windows, WindowTexturesHash::iterator it)
+{
+    QObject::disconnect(it->invalidatedConnection);
+    QObject::disconnect(it->destroyedConnection);
+    return windows.erase(it);
+}
+
 ImageTexturesCache::ImageTexturesCache()
     : d(new ImageTexturesCachePrivate)
 {
@@ -29,20 +40,86 @@ ImageTexturesCache::~ImageTexturesCache()
 
 QSharedPointer<QSGTexture> ImageTexturesCache::loadTexture(QQuickWindow *window, const QImage &image, QQuickWindow::CreateTextureOptions options)
 {
+    auto &windows = d->windows.localData();
+
+    auto windowIt = windows.find(window);
+    if (windowIt == windows.end() || !windowIt->window) {
+        // With the threaded render loop destroyed() is emitted on the GUI
+        // thread, which doesn't see this storage. Entries of windows destroyed
+        // without invalidating their scene graph are dropped here instead,
+        // before their address can be mistaken for the one of a new window.
+        for (auto it = windows.begin(); it != windows.end();) {
+            if (!it->window) {
+                it = forgetWindow(windows, it);
+            } else {
+                ++it;
+            }
+        }
+
+        windowIt = windows.insert(window, WindowTextures{});
+        windowIt->window = window;
+        // The textures of a window go away together with its scene graph.
+        // This is emitted on the render thread, so the right storage is used.
+        windowIt->invalidatedConnection = QObject::connect(
+            window,
+            &QQuickWindow::sceneGraphInvalidated,
+            window,
+            [this, window]() {
+                auto &windows = d->windows.localData();
+                auto it = windows.find(window);
+                if (it != windows.end()) {
+                    forgetWindow(windows, it);
+                }
+            },
+            Qt::DirectConnection);
+        // Only when the window is rendered on its own thread, as with the
+        // basic and windows render loops, is destroyed() emitted on the
+        // thread owning this storage. The threaded loop relies on the sweep
+        // above instead.
+        if (window->thread() == QThread::currentThread()) {
+            windowIt->destroyedConnection = QObject::connect(
+                window,
+                &QObject::destroyed,
+                window,
+                [this, window]() {
+                    auto &windows = d->windows.localData();
+                    auto it = windows.find(window);
+                    if (it != windows.end()) {
+                        forgetWindow(windows, it);
+                    }
+                },
+                Qt::DirectConnection);
+        }
+    }
+
+    WindowTextures &windowTextures = *windowIt;
+
     qint64 id = image.cacheKey();
-    QSharedPointer<QSGTexture> texture = d->cache.value(id).value(window).toStrongRef();
+    QSharedPointer<QSGTexture> texture = windowTextures.textures.value(id).toStrongRef();
 
     if (!texture) {
-        auto cleanAndDelete = [this, window, id](QSGTexture *texture) {
-            QHash<QWindow *, QWeakPointer<QSGTexture>> &textures = (d->cache)[id];
-            textures.remove(window);
-            if (textures.isEmpty()) {
-                d->cache.remove(id);
+        // The deleter does not touch the cache, as the last reference may be
+        // dropped on any thread. Expired entries are swept here instead.
+        auto deleteTexture = [](QSGTexture *texture) {
+            if (texture->thread() == QThread::currentThread()) {
+                delete texture;
+            } else {
+                texture->deleteLater();
             }
-            delete texture;
         };
-        texture = QSharedPointer<QSGTexture>(window->createTextureFromImage(image, options), cleanAndDelete);
-        (d->cache)[id][window] = texture.toWeakRef();
+        texture = QSharedPointer<QSGTexture>(window->createTextureFromImage(image, options), deleteTexture);
+        windowTextures.textures.insert(id, texture.toWeakRef());
+
+        if (windowTextures.textures.size() > windowTextures.sweepThreshold) {
+            for (auto it = windowTextures.textures.begin(); it != windowTextures.textures.end();) {
+                if (it->isNull()) {
+                    it = windowTextures.textures.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            windowTextures.sweepThreshold = qMax(64, windowTextures.textures.size() * 2);
+        }
     }
 
     // if we have a cache in an atlas but our request cannot use an atlassed texture
@@ -8,10 +8,12 @@
 
 #pragma once
 #include <QImage>
+#include <QPointer>
 #include <QQuickWindow>
 #include <QSGSimpleTextureNode>
 #include <QSGTexture>
 #include <QSharedPointer>
+#include <QThreadStorage>
 
 class ManagedTextureNode : public QSGSimpleTextureNode
 {
@@ -25,10 +27,24 @@ private:
     QSharedPointer<QSGTexture> m_texture;
 };
 
-typedef QHash<qint64, QHash<QWindow *, QWeakPointer<QSGTexture>>> TexturesCache;
+struct WindowTextures {
+    // Null once the window is destroyed, another window may then get the same address
+    QPointer<QQuickWindow> window;
+    QHash<qint64, QWeakPointer<QSGTexture>> textures;
+    QMetaObject::Connection invalidatedConnection;
+    QMetaObject::Connection destroyedConnection;
+    int sweepThreshold = 0;
+};
 
+/**
+ * Textures are only ever used by the window they were created for, so they
+ * are stored per window. The windows are in turn stored per thread: with the
+ * threaded render loop each window is rendered by its own thread, with the
+ * other loops they share the GUI thread. Either way a thread only ever sees
+ * its own windows and no locking is needed.
+ */
 struct ImageTexturesCachePrivate {
-    TexturesCache cache;
+    QThreadStorage<QHash<QQuickWindow *, WindowTextures>> windows;
 };
 
 class ImageTexturesCache
@@ -42,6 +58,9 @@ public:
      *
      * If an @p image id is the same as one already provided before, we won't create
      * a new texture and return a shared pointer to the existing texture.
+     *
+     * This must be called from the thread rendering @p window, usually from
+     * QQuickItem::updatePaintNode().
      */
     QSharedPointer<QSGTexture> loadTexture(QQuickWindow *window, const QImage &image, QQuickWindow::CreateTextureOptions options);
 
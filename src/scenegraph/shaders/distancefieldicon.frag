@@ -0,0 +1,29 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+// This shader renders a monochrome icon from a signed distance field. The
+// field stores 0.5 on the outline of the icon, with larger values inside.
+
+uniform lowp float opacity;
+uniform lowp vec4 color;
+uniform mediump float smoothing;
+uniform sampler2D textureSource;
+
+#ifdef CORE_PROFILE
+in mediump vec2 uv;
+out lowp vec4 out_color;
+#else
+varying mediump vec2 uv;
+#define out_color gl_FragColor
+#define texture texture2D
+#endif
+
+void main()
+{
+    mediump float distance = texture(textureSource, uv).r;
+    lowp float coverage = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+    out_color = color * coverage * opacity;
+}
@@ -0,0 +1,22 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+uniform highp mat4 matrix;
+
+#ifdef CORE_PROFILE
+in highp vec4 in_vertex;
+in mediump vec2 in_uv;
+out mediump vec2 uv;
+#else
+attribute highp vec4 in_vertex;
+attribute mediump vec2 in_uv;
+varying mediump vec2 uv;
+#endif
+
+void main() {
+    uv = in_uv;
+    gl_Position = matrix * in_vertex;
+}
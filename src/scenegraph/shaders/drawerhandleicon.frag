@@ -0,0 +1,42 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+// See sdf.glsl for the SDF related functions.
+
+// This shader renders the three bars of a drawer handle icon as the union of
+// three rotated rectangles, so overlapping bars are not blended twice.
+
+uniform lowp float opacity;
+uniform lowp vec4 color;
+// Center in xy, half length and half thickness in zw.
+uniform lowp vec4 bars[3];
+// Cosine and sine of the rotation of each bar.
+uniform lowp vec2 rotations[3];
+
+#ifdef CORE_PROFILE
+in lowp vec2 uv;
+out lowp vec4 out_color;
+#else
+varying lowp vec2 uv;
+#define out_color gl_FragColor
+#endif
+
+lowp float sdf_bar(in lowp vec2 point, in lowp vec4 bar, in lowp vec2 rotation)
+{
+    lowp vec2 p = point - bar.xy;
+    p = vec2(p.x * rotation.x + p.y * rotation.y, p.y * rotation.x - p.x * rotation.y);
+    return sdf_rectangle(p, bar.zw);
+}
+
+void main()
+{
+    lowp float shape = sdf_bar(uv, bars[0], rotations[0]);
+    shape = sdf_union(shape, sdf_bar(uv, bars[1], rotations[1]));
+    shape = sdf_union(shape, sdf_bar(uv, bars[2], rotations[2]));
+
+    // Half a pixel of smoothing keeps edges that fall on pixel boundaries sharp.
+    out_color = sdf_render(shape, vec4(0.0), color, 0.5) * opacity;
+}
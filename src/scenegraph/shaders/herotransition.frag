@@ -0,0 +1,34 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+// See sdf.glsl for the SDF related functions.
+
+// This shader renders a snapshot texture clipped to a rounded rectangle, for
+// one side of a hero transition.
+
+uniform lowp float opacity;
+uniform lowp vec2 aspect;
+uniform lowp float radius;
+uniform lowp float fade;
+uniform sampler2D textureSource;
+
+#ifdef CORE_PROFILE
+in lowp vec2 uv;
+out lowp vec4 out_color;
+#else
+varying lowp vec2 uv;
+#define out_color gl_FragColor
+#define texture texture2D
+#endif
+
+void main()
+{
+    lowp vec2 texture_uv = ((uv / aspect) + 1.0) / 2.0;
+    lowp vec4 texture_color = texture(textureSource, texture_uv);
+
+    lowp float shape = sdf_rounded_rectangle(uv, aspect, vec4(radius));
+    out_color = sdf_render(shape, vec4(0.0), texture_color) * fade * opacity;
+}
@@ -0,0 +1,32 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+// This shader renders a snapshot texture multiplied with the alpha of a mask
+// texture, for one side of a hero transition.
+
+uniform lowp float opacity;
+uniform lowp vec2 aspect;
+uniform lowp float fade;
+uniform sampler2D textureSource;
+uniform sampler2D maskSource;
+
+#ifdef CORE_PROFILE
+in lowp vec2 uv;
+out lowp vec4 out_color;
+#else
+varying lowp vec2 uv;
+#define out_color gl_FragColor
+#define texture texture2D
+#endif
+
+void main()
+{
+    lowp vec2 texture_uv = ((uv / aspect) + 1.0) / 2.0;
+    lowp vec4 texture_color = texture(textureSource, texture_uv);
+    lowp float mask = texture(maskSource, texture_uv).a;
+
+    out_color = texture_color * mask * fade * opacity;
+}
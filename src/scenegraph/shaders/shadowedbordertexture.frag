@@ -19,6 +19,7 @@ uniform lowp vec2 aspect;
 uniform lowp float borderWidth;
 uniform lowp vec4 borderColor;
 uniform sampler2D textureSource;
+uniform lowp vec4 textureRect;
 
 #ifdef CORE_PROFILE
 in lowp vec2 uv;
@@ -65,6 +66,7 @@ void main()
 
     // Sample the texture, then blend it on top of the background color.
     lowp vec2 texture_uv = ((uv / aspect) + (1.0 * inverse_scale)) / (2.0 * inverse_scale);
+    texture_uv = textureRect.xy + texture_uv * textureRect.zw;
     lowp vec4 texture_color = texture(textureSource, texture_uv);
     col = sdf_render(inner_rect, col, texture_color, texture_color.a, sdf_default_smoothing);
 
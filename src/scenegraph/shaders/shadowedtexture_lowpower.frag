@@ -17,6 +17,7 @@ uniform lowp vec4 shadowColor;
 uniform lowp vec2 offset;
 uniform lowp vec2 aspect;
 uniform sampler2D textureSource;
+uniform lowp vec4 textureRect;
 
 #ifdef CORE_PROFILE
 in lowp vec2 uv;
@@ -39,6 +40,7 @@ void main()
 
     // Sample the texture, then render it, blending it with the background.
     lowp vec2 texture_uv = ((uv / aspect) + 1.0) / 2.0;
+    texture_uv = textureRect.xy + texture_uv * textureRect.zw;
     lowp vec4 texture_color = texture(textureSource, texture_uv);
     col = sdf_render(rect, col, texture_color, texture_color.a, sdf_default_smoothing);
 
@@ -32,11 +32,13 @@ int ShadowedBorderTextureMaterial::compare(const QSGMaterial *other) const
 
     auto result = ShadowedBorderRectangleMaterial::compare(other);
     if (result == 0) {
-        if (material->textureSource == textureSource) {
-            return 0;
-        } else {
+        if (material->textureSource != textureSource) {
             return (material->textureSource < textureSource) ? 1 : -1;
         }
+        if (!qFuzzyCompare(material->textureRect, textureRect)) {
+            return QSGMaterial::compare(other);
+        }
+        return 0;
     }
 
     return result;
@@ -52,14 +54,19 @@ void ShadowedBorderTextureShader::initialize()
 {
     ShadowedBorderRectangleShader::initialize();
     program()->setUniformValue("textureSource", 0);
+    m_textureRectLocation = program()->uniformLocation("textureRect");
 }
 
 void ShadowedBorderTextureShader::updateState(const QSGMaterialShader::RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial)
 {
     ShadowedBorderRectangleShader::updateState(state, newMaterial, oldMaterial);
 
-    auto texture = static_cast<ShadowedBorderTextureMaterial *>(newMaterial)->textureSource;
-    if (texture) {
-        texture->bind();
+    auto material = static_cast<ShadowedBorderTextureMaterial *>(newMaterial);
+    if (!oldMaterial || newMaterial->compare(oldMaterial) != 0 || state.isCachedMaterialDataDirty()) {
+        program()->setUniformValue(m_textureRectLocation, material->textureRect);
+    }
+
+    if (material->textureSource) {
+        material->textureSource->bind();
     }
 }
@@ -23,7 +23,7 @@ ShadowedRectangleNode::ShadowedRectangleNode()
     setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
 }
 
-void ShadowedRectangleNode::setBorderEnabled(bool enabled)
+bool ShadowedRectangleNode::setBorderEnabled(bool enabled)
 {
     // We can achieve more performant shaders by splitting the two into separate
     // shaders. This requires separating the materials as well. So when
@@ -38,6 +38,7 @@ void ShadowedRectangleNode::setBorderEnabled(bool enabled)
             m_material = newMaterial;
             m_rect = QRectF{};
             markDirty(QSGNode::DirtyMaterial);
+            return true;
         }
     } else {
         if (!m_material || m_material->type() == borderMaterialType()) {
@@ -47,8 +48,10 @@ void ShadowedRectangleNode::setBorderEnabled(bool enabled)
             m_material = newMaterial;
             m_rect = QRectF{};
             markDirty(QSGNode::DirtyMaterial);
+            return true;
         }
     }
+    return false;
 }
 
 void ShadowedRectangleNode::setRect(const QRectF &rect)
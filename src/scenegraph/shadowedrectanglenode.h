@@ -22,8 +22,9 @@ class ShadowedBorderRectangleMaterial;
  * This node will set up the geometry and materials for a shadowed rectangle,
  * optionally with rounded corners.
  *
- * \note You must call updateGeometry() after setting properties of this node,
- * otherwise the node's state will not correctly reflect all the properties.
+ * \note You must call updateGeometry() after changing the rect, size or offset
+ * of this node, otherwise the node's state will not correctly reflect all the
+ * properties. Other properties only affect the material.
  *
  * \sa ShadowedRectangle
  */
@@ -37,8 +38,11 @@ public:
      *
      * Note that this will switch between a material with or without border.
      * This means this needs to be called before any other setters.
+     *
+     * \return true if the material was replaced, in which case all other
+     * properties need to be set again.
      */
-    void setBorderEnabled(bool enabled);
+    bool setBorderEnabled(bool enabled);
 
     void setRect(const QRectF &rect);
     void setSize(qreal size);
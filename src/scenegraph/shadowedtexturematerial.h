@@ -26,6 +26,11 @@ public:
     int compare(const QSGMaterial *other) const override;
 
     QSGTexture *textureSource = nullptr;
+    /**
+     * The part of the texture that is shown, in normalized texture
+     * coordinates, as x, y, width and height.
+     */
+    QVector4D textureRect = QVector4D{0.0, 0.0, 1.0, 1.0};
 
     static QSGMaterialType staticType;
 };
@@ -37,4 +42,7 @@ public:
 
     void initialize() override;
     void updateState(const QSGMaterialShader::RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override;
+
+private:
+    int m_textureRectLocation = -1;
 };
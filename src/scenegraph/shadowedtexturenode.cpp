@@ -9,9 +9,10 @@
 #include "shadowedbordertexturematerial.h"
 
 template<typename T>
-inline void preprocessTexture(QSGMaterial *material, QSGTextureProvider *provider)
+inline void preprocessTexture(QSGMaterial *material, QSGTextureProvider *provider, const QVector4D &textureRect)
 {
     auto m = static_cast<T *>(material);
+    m->textureRect = textureRect;
     // Since we handle texture coordinates differently in the shader, we
     // need to remove the texture from the atlas for now.
     if (provider->texture()->isAtlasTexture()) {
@@ -49,13 +50,24 @@ void ShadowedTextureNode::setTextureSource(QSGTextureProvider *source)
     markDirty(QSGNode::DirtyMaterial);
 }
 
+void ShadowedTextureNode::setTextureRect(const QRectF &rect)
+{
+    const auto textureRect = QVector4D{float(rect.x()), float(rect.y()), float(rect.width()), float(rect.height())};
+    if (qFuzzyCompare(textureRect, m_textureRect)) {
+        return;
+    }
+
+    m_textureRect = textureRect;
+    markDirty(QSGNode::DirtyMaterial);
+}
+
 void ShadowedTextureNode::preprocess()
 {
     if (m_textureSource && m_material && m_textureSource->texture()) {
         if (m_material->type() == borderlessMaterialType()) {
-            preprocessTexture<ShadowedTextureMaterial>(m_material, m_textureSource);
+            preprocessTexture<ShadowedTextureMaterial>(m_material, m_textureSource, m_textureRect);
         } else {
-            preprocessTexture<ShadowedBorderTextureMaterial>(m_material, m_textureSource);
+            preprocessTexture<ShadowedBorderTextureMaterial>(m_material, m_textureSource, m_textureRect);
         }
     }
 }
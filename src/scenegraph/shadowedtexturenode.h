@@ -19,8 +19,9 @@
  * optionally with rounded corners, using a supplied texture source as the color
  * for the rectangle.
  *
- * \note You must call updateGeometry() after setting properties of this node,
- * otherwise the node's state will not correctly reflect all the properties.
+ * \note You must call updateGeometry() after changing the rect, size or offset
+ * of this node, otherwise the node's state will not correctly reflect all the
+ * properties. Other properties only affect the material.
  *
  * \sa ShadowedTexture
  */
@@ -30,6 +31,10 @@ public:
     ShadowedTextureNode();
 
     void setTextureSource(QSGTextureProvider *source);
+    /**
+     * Set the part of the texture to show, in normalized texture coordinates.
+     */
+    void setTextureRect(const QRectF &rect);
     void preprocess() override;
 
 private:
@@ -39,4 +44,5 @@ private:
     QSGMaterialType *borderMaterialType() override;
 
     QPointer<QSGTextureProvider> m_textureSource;
+    QVector4D m_textureRect = QVector4D{0.0, 0.0, 1.0, 1.0};
 };
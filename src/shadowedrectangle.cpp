@@ -10,9 +10,17 @@
 #include <QSGRectangleNode>
 #include <QSGRendererInterface>
 
+#include <utility>
+
 #include "scenegraph/paintedrectangleitem.h"
 #include "scenegraph/shadowedrectanglenode.h"
 
+// Most items only use one or two of the groups, the values of the others are
+// read from these.
+Q_GLOBAL_STATIC(BorderGroup, s_defaultBorder)
+Q_GLOBAL_STATIC(ShadowGroup, s_defaultShadow)
+Q_GLOBAL_STATIC(CornersGroup, s_defaultCorners)
+
 BorderGroup::BorderGroup(QObject *parent)
     : QObject(parent)
 {
@@ -30,6 +38,7 @@ void BorderGroup::setWidth(qreal newWidth)
     }
 
     m_width = newWidth;
+    m_dirty |= WidthDirty;
     Q_EMIT changed();
 }
 
@@ -45,9 +54,15 @@ void BorderGroup::setColor(const QColor &newColor)
     }
 
     m_color = newColor;
+    m_dirty |= ColorDirty;
     Q_EMIT changed();
 }
 
+BorderGroup::DirtyFlags BorderGroup::takeDirtyFlags()
+{
+    return std::exchange(m_dirty, DirtyFlags{});
+}
+
 ShadowGroup::ShadowGroup(QObject *parent)
     : QObject(parent)
 {
@@ -65,6 +80,7 @@ void ShadowGroup::setSize(qreal newSize)
     }
 
     m_size = newSize;
+    m_dirty |= SizeDirty;
     Q_EMIT changed();
 }
 
@@ -80,6 +96,7 @@ void ShadowGroup::setXOffset(qreal newXOffset)
     }
 
     m_xOffset = newXOffset;
+    m_dirty |= OffsetDirty;
     Q_EMIT changed();
 }
 
@@ -95,6 +112,7 @@ void ShadowGroup::setYOffset(qreal newYOffset)
     }
 
     m_yOffset = newYOffset;
+    m_dirty |= OffsetDirty;
     Q_EMIT changed();
 }
 
@@ -110,9 +128,15 @@ void ShadowGroup::setColor(const QColor &newColor)
     }
 
     m_color = newColor;
+    m_dirty |= ColorDirty;
     Q_EMIT changed();
 }
 
+ShadowGroup::DirtyFlags ShadowGroup::takeDirtyFlags()
+{
+    return std::exchange(m_dirty, DirtyFlags{});
+}
+
 CornersGroup::CornersGroup(QObject *parent)
     : QObject(parent)
 {
@@ -130,6 +154,7 @@ void CornersGroup::setTopLeft(qreal newTopLeft)
     }
 
     m_topLeft = newTopLeft;
+    m_dirty = true;
     Q_EMIT changed();
 }
 
@@ -145,6 +170,7 @@ void CornersGroup::setTopRight(qreal newTopRight)
     }
 
     m_topRight = newTopRight;
+    m_dirty = true;
     Q_EMIT changed();
 }
 
@@ -160,6 +186,7 @@ void CornersGroup::setBottomLeft(qreal newBottomLeft)
     }
 
     m_bottomLeft = newBottomLeft;
+    m_dirty = true;
     Q_EMIT changed();
 }
 
@@ -175,6 +202,7 @@ void CornersGroup::setBottomRight(qreal newBottomRight)
     }
 
     m_bottomRight = newBottomRight;
+    m_dirty = true;
     Q_EMIT changed();
 }
 
@@ -186,17 +214,15 @@ QVector4D CornersGroup::toVector4D(float all) const
                      m_topLeft < 0.0 ? all : m_topLeft};
 }
 
+bool CornersGroup::takeDirty()
+{
+    return std::exchange(m_dirty, false);
+}
+
 ShadowedRectangle::ShadowedRectangle(QQuickItem *parentItem)
     : QQuickItem(parentItem)
-    , m_border(std::make_unique<BorderGroup>())
-    , m_shadow(std::make_unique<ShadowGroup>())
-    , m_corners(std::make_unique<CornersGroup>())
 {
     setFlag(QQuickItem::ItemHasContents, true);
-
-    connect(m_border.get(), &BorderGroup::changed, this, &ShadowedRectangle::update);
-    connect(m_shadow.get(), &ShadowGroup::changed, this, &ShadowedRectangle::update);
-    connect(m_corners.get(), &CornersGroup::changed, this, &ShadowedRectangle::update);
 }
 
 ShadowedRectangle::~ShadowedRectangle()
@@ -205,19 +231,46 @@ ShadowedRectangle::~ShadowedRectangle()
 
 BorderGroup *ShadowedRectangle::border() const
 {
+    if (!m_border) {
+        m_border = std::make_unique<BorderGroup>();
+        connect(m_border.get(), &BorderGroup::changed, this, &ShadowedRectangle::update);
+    }
     return m_border.get();
 }
 
 ShadowGroup *ShadowedRectangle::shadow() const
 {
+    if (!m_shadow) {
+        m_shadow = std::make_unique<ShadowGroup>();
+        connect(m_shadow.get(), &ShadowGroup::changed, this, &ShadowedRectangle::update);
+    }
     return m_shadow.get();
 }
 
 CornersGroup *ShadowedRectangle::corners() const
 {
+    if (!m_corners) {
+        m_corners = std::make_unique<CornersGroup>();
+        connect(m_corners.get(), &CornersGroup::changed, this, &ShadowedRectangle::update);
+    }
     return m_corners.get();
 }
 
+const BorderGroup *ShadowedRectangle::borderValues() const
+{
+    return m_border ? m_border.get() : s_defaultBorder();
+}
+
+const ShadowGroup *ShadowedRectangle::shadowValues() const
+{
+    return m_shadow ? m_shadow.get() : s_defaultShadow();
+}
+
+const CornersGroup *ShadowedRectangle::cornersValues() const
+{
+    return m_corners ? m_corners.get() : s_defaultCorners();
+}
+
 qreal ShadowedRectangle::radius() const
 {
     return m_radius;
@@ -230,6 +283,7 @@ void ShadowedRectangle::setRadius(qreal newRadius)
     }
 
     m_radius = newRadius;
+    m_dirty |= RadiusDirty;
     if (!isSoftwareRendering()) {
         update();
     }
@@ -248,6 +302,7 @@ void ShadowedRectangle::setColor(const QColor &newColor)
     }
 
     m_color = newColor;
+    m_dirty |= ColorDirty;
     if (!isSoftwareRendering()) {
         update();
     }
@@ -280,14 +335,24 @@ void ShadowedRectangle::itemChange(QQuickItem::ItemChange change, const QQuickIt
     }
 }
 
+void ShadowedRectangle::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    if (newGeometry.size() != oldGeometry.size()) {
+        m_dirty |= RectDirty;
+    }
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+}
+
 QSGNode *ShadowedRectangle::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data)
 {
     Q_UNUSED(data);
 
     auto shadowNode = static_cast<ShadowedRectangleNode *>(node);
+    bool all = false;
 
     if (!shadowNode) {
         shadowNode = new ShadowedRectangleNode{};
+        all = true;
 
         // Cache lowPower state so we only execute the full check once.
         static bool lowPower = QByteArrayList{"1", "true"}.contains(qgetenv("KIRIGAMI_LOWPOWER_HARDWARE").toLower());
@@ -296,19 +361,61 @@ QSGNode *ShadowedRectangle::updatePaintNode(QSGNode *node, QQuickItem::UpdatePai
         }
     }
 
-    shadowNode->setBorderEnabled(m_border->isEnabled());
-    shadowNode->setRect(boundingRect());
-    shadowNode->setSize(m_shadow->size());
-    shadowNode->setRadius(m_corners->toVector4D(m_radius));
-    shadowNode->setOffset(QVector2D{float(m_shadow->xOffset()), float(m_shadow->yOffset())});
-    shadowNode->setColor(m_color);
-    shadowNode->setShadowColor(m_shadow->color());
-    shadowNode->setBorderWidth(m_border->width());
-    shadowNode->setBorderColor(m_border->color());
-    shadowNode->updateGeometry();
+    updateShadowNode(shadowNode, all);
     return shadowNode;
 }
 
+void ShadowedRectangle::updateShadowNode(ShadowedRectangleNode *node, bool all)
+{
+    const auto dirty = std::exchange(m_dirty, DirtyFlags{});
+    const auto borderDirty = m_border ? m_border->takeDirtyFlags() : BorderGroup::DirtyFlags{};
+    const auto shadowDirty = m_shadow ? m_shadow->takeDirtyFlags() : ShadowGroup::DirtyFlags{};
+    const auto cornersDirty = m_corners ? m_corners->takeDirty() : false;
+
+    const auto border = borderValues();
+    const auto shadow = shadowValues();
+    const auto corners = cornersValues();
+
+    // Switching between the border and borderless material discards all uniforms.
+    if (node->setBorderEnabled(border->isEnabled())) {
+        all = true;
+    }
+
+    // Size, radius, offset and border width are relative to the rect, so they
+    // need to be recalculated whenever it changes.
+    const bool rectDirty = all || dirty.testFlag(RectDirty);
+    if (rectDirty) {
+        node->setRect(boundingRect());
+    }
+    if (rectDirty || shadowDirty.testFlag(ShadowGroup::SizeDirty)) {
+        node->setSize(shadow->size());
+    }
+    if (rectDirty || dirty.testFlag(RadiusDirty) || cornersDirty) {
+        node->setRadius(corners->toVector4D(m_radius));
+    }
+    if (rectDirty || shadowDirty.testFlag(ShadowGroup::OffsetDirty)) {
+        node->setOffset(QVector2D{float(shadow->xOffset()), float(shadow->yOffset())});
+    }
+    if (all || dirty.testFlag(ColorDirty)) {
+        node->setColor(m_color);
+    }
+    if (all || shadowDirty.testFlag(ShadowGroup::ColorDirty)) {
+        node->setShadowColor(shadow->color());
+    }
+    if (rectDirty || borderDirty.testFlag(BorderGroup::WidthDirty)) {
+        node->setBorderWidth(border->width());
+    }
+    if (all || borderDirty.testFlag(BorderGroup::ColorDirty)) {
+        node->setBorderColor(border->color());
+    }
+
+    // Only the rect and the shadow extents affect the vertices, colors and
+    // radii are pure uniform changes.
+    if (rectDirty || shadowDirty.testFlag(ShadowGroup::SizeDirty) || shadowDirty.testFlag(ShadowGroup::OffsetDirty)) {
+        node->updateGeometry();
+    }
+}
+
 void ShadowedRectangle::checkSoftwareItem()
 {
     if (!m_softwareItem && isSoftwareRendering()) {
@@ -319,6 +426,9 @@ void ShadowedRectangle::checkSoftwareItem()
         // value for the child, to force it to be the lowest item.
         m_softwareItem->setZ(-99.0);
 
+        // Created here so that the item follows changes of the border.
+        border();
+
         auto updateItem = [this]() {
             auto borderWidth = m_border->width();
             auto rect = boundingRect();
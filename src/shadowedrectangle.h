@@ -10,6 +10,7 @@
 #include <memory>
 
 class PaintedRectangleItem;
+class ShadowedRectangleNode;
 
 /**
  * Grouped property for rectangle border.
@@ -31,6 +32,12 @@ class BorderGroup : public QObject
     Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY changed)
 
 public:
+    enum DirtyFlag {
+        WidthDirty = 1 << 0,
+        ColorDirty = 1 << 1,
+    };
+    Q_DECLARE_FLAGS(DirtyFlags, DirtyFlag)
+
     explicit BorderGroup(QObject *parent = nullptr);
 
     qreal width() const;
@@ -46,9 +53,15 @@ public:
         return !qFuzzyIsNull(m_width);
     }
 
+    /**
+     * Returns the properties that changed since the last call and clears them.
+     */
+    DirtyFlags takeDirtyFlags();
+
 private:
     qreal m_width = 0.0;
     QColor m_color = Qt::black;
+    DirtyFlags m_dirty;
 };
 
 /**
@@ -85,6 +98,13 @@ class ShadowGroup : public QObject
     Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY changed)
 
 public:
+    enum DirtyFlag {
+        SizeDirty = 1 << 0,
+        OffsetDirty = 1 << 1,
+        ColorDirty = 1 << 2,
+    };
+    Q_DECLARE_FLAGS(DirtyFlags, DirtyFlag)
+
     explicit ShadowGroup(QObject *parent = nullptr);
 
     qreal size() const;
@@ -101,11 +121,17 @@ public:
 
     Q_SIGNAL void changed();
 
+    /**
+     * Returns the properties that changed since the last call and clears them.
+     */
+    DirtyFlags takeDirtyFlags();
+
 private:
     qreal m_size = 0.0;
     qreal m_xOffset = 0.0;
     qreal m_yOffset = 0.0;
     QColor m_color = Qt::black;
+    DirtyFlags m_dirty;
 };
 
 /**
@@ -158,11 +184,17 @@ public:
 
     QVector4D toVector4D(float all) const;
 
+    /**
+     * Returns whether any radius changed since the last call and clears it.
+     */
+    bool takeDirty();
+
 private:
     float m_topLeft = -1.0;
     float m_topRight = -1.0;
     float m_bottomLeft = -1.0;
     float m_bottomRight = -1.0;
+    bool m_dirty = false;
 };
 
 /**
@@ -197,6 +229,9 @@ class ShadowedRectangle : public QQuickItem
     /**
      * Border properties.
      *
+     * The group objects are only created when they are first accessed, until
+     * then the defaults are used.
+     *
      * \sa BorderGroup
      */
     Q_PROPERTY(BorderGroup *border READ border CONSTANT)
@@ -241,16 +276,43 @@ Q_SIGNALS:
     void softwareRenderingChanged();
 
 protected:
+    enum DirtyFlag {
+        RectDirty = 1 << 0,
+        RadiusDirty = 1 << 1,
+        ColorDirty = 1 << 2,
+    };
+    Q_DECLARE_FLAGS(DirtyFlags, DirtyFlag)
+
     PaintedRectangleItem *softwareItem() const;
     void itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &value) override;
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
     QSGNode *updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data) override;
 
+    /**
+     * Push the properties that changed since the last update to \p node.
+     *
+     * The geometry is only regenerated when the rect or the shadow extents
+     * changed. If \p all is true, for example because the node was just
+     * created, every property is pushed.
+     */
+    void updateShadowNode(ShadowedRectangleNode *node, bool all);
+
 private:
     void checkSoftwareItem();
-    const std::unique_ptr<BorderGroup> m_border;
-    const std::unique_ptr<ShadowGroup> m_shadow;
-    const std::unique_ptr<CornersGroup> m_corners;
+
+    // The groups if they were accessed, the shared defaults otherwise.
+    const BorderGroup *borderValues() const;
+    const ShadowGroup *shadowValues() const;
+    const CornersGroup *cornersValues() const;
+
+    mutable std::unique_ptr<BorderGroup> m_border;
+    mutable std::unique_ptr<ShadowGroup> m_shadow;
+    mutable std::unique_ptr<CornersGroup> m_corners;
     qreal m_radius = 0.0;
     QColor m_color = Qt::white;
     PaintedRectangleItem *m_softwareItem = nullptr;
+    DirtyFlags m_dirty;
 };
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(BorderGroup::DirtyFlags)
+Q_DECLARE_OPERATORS_FOR_FLAGS(ShadowGroup::DirtyFlags)
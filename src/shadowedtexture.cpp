@@ -32,23 +32,80 @@ void ShadowedTexture::setSource(QQuickItem *newSource)
         return;
     }
 
+    if (m_source) {
+        disconnect(m_source, nullptr, this, nullptr);
+    }
+
     m_source = newSource;
     m_sourceChanged = true;
     if (m_source && !m_source->parentItem()) {
         m_source->setParentItem(this);
     }
 
+    if (m_source) {
+        // The crop depends on the aspect ratio of the source.
+        connect(m_source, &QQuickItem::implicitWidthChanged, this, &QQuickItem::update);
+        connect(m_source, &QQuickItem::implicitHeightChanged, this, &QQuickItem::update);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            m_sourceChanged = true;
+            update();
+        });
+    }
+
     if (!isSoftwareRendering()) {
         update();
     }
     Q_EMIT sourceChanged();
 }
 
+ShadowedTexture::FillMode ShadowedTexture::fillMode() const
+{
+    return m_fillMode;
+}
+
+void ShadowedTexture::setFillMode(FillMode newFillMode)
+{
+    if (newFillMode == m_fillMode) {
+        return;
+    }
+
+    m_fillMode = newFillMode;
+    if (!isSoftwareRendering()) {
+        update();
+    }
+    Q_EMIT fillModeChanged();
+}
+
+QRectF ShadowedTexture::textureRect() const
+{
+    if (m_fillMode == Stretch || !m_source || width() <= 0.0 || height() <= 0.0) {
+        return QRectF{0.0, 0.0, 1.0, 1.0};
+    }
+
+    const qreal sourceWidth = m_source->implicitWidth();
+    const qreal sourceHeight = m_source->implicitHeight();
+    if (sourceWidth <= 0.0 || sourceHeight <= 0.0) {
+        return QRectF{0.0, 0.0, 1.0, 1.0};
+    }
+
+    const qreal itemAspect = width() / height();
+    const qreal sourceAspect = sourceWidth / sourceHeight;
+    if (sourceAspect > itemAspect) {
+        const qreal visibleWidth = itemAspect / sourceAspect;
+        return QRectF{(1.0 - visibleWidth) / 2.0, 0.0, visibleWidth, 1.0};
+    } else {
+        const qreal visibleHeight = sourceAspect / itemAspect;
+        return QRectF{0.0, (1.0 - visibleHeight) / 2.0, 1.0, visibleHeight};
+    }
+}
+
 QSGNode *ShadowedTexture::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data)
 {
     Q_UNUSED(data);
 
     auto shadowNode = static_cast<ShadowedRectangleNode *>(node);
+    bool all = false;
 
     if (!shadowNode || m_sourceChanged) {
         m_sourceChanged = false;
@@ -58,26 +115,20 @@ QSGNode *ShadowedTexture::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaint
         } else {
             shadowNode = new ShadowedRectangleNode{};
         }
+        all = true;
 
         if (qEnvironmentVariableIsSet("KIRIGAMI_LOWPOWER_HARDWARE")) {
             shadowNode->setShaderType(ShadowedRectangleMaterial::ShaderType::LowPower);
         }
     }
 
-    shadowNode->setBorderEnabled(border()->isEnabled());
-    shadowNode->setRect(boundingRect());
-    shadowNode->setSize(shadow()->size());
-    shadowNode->setRadius(corners()->toVector4D(radius()));
-    shadowNode->setOffset(QVector2D{float(shadow()->xOffset()), float(shadow()->yOffset())});
-    shadowNode->setColor(color());
-    shadowNode->setShadowColor(shadow()->color());
-    shadowNode->setBorderWidth(border()->width());
-    shadowNode->setBorderColor(border()->color());
+    updateShadowNode(shadowNode, all);
 
     if (m_source) {
-        static_cast<ShadowedTextureNode *>(shadowNode)->setTextureSource(m_source->textureProvider());
+        auto textureNode = static_cast<ShadowedTextureNode *>(shadowNode);
+        textureNode->setTextureSource(m_source->textureProvider());
+        textureNode->setTextureRect(textureRect());
     }
 
-    shadowNode->updateGeometry();
     return shadowNode;
 }
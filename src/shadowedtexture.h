@@ -24,7 +24,25 @@ class ShadowedTexture : public ShadowedRectangle
 
     Q_PROPERTY(QQuickItem *source READ source WRITE setSource NOTIFY sourceChanged)
 
+    /**
+     * How the source is fit into the rectangle.
+     *
+     * * `Stretch`: The source is scaled to the size of the rectangle. This is the default.
+     * * `PreserveAspectCrop`: The source is scaled uniformly to cover the rectangle,
+     *   the parts that do not fit are cropped. The aspect ratio of the source is
+     *   taken from its implicit size.
+     *
+     * @since 5.88
+     */
+    Q_PROPERTY(FillMode fillMode READ fillMode WRITE setFillMode NOTIFY fillModeChanged)
+
 public:
+    enum FillMode {
+        Stretch,
+        PreserveAspectCrop,
+    };
+    Q_ENUM(FillMode)
+
     ShadowedTexture(QQuickItem *parent = nullptr);
     ~ShadowedTexture() override;
 
@@ -32,10 +50,17 @@ public:
     void setSource(QQuickItem *newSource);
     Q_SIGNAL void sourceChanged();
 
+    FillMode fillMode() const;
+    void setFillMode(FillMode newFillMode);
+    Q_SIGNAL void fillModeChanged();
+
 protected:
     QSGNode *updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *data) override;
 
 private:
+    QRectF textureRect() const;
+
     QQuickItem *m_source = nullptr;
     bool m_sourceChanged = false;
+    FillMode m_fillMode = Stretch;
 };
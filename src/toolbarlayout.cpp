@@ -6,17 +6,23 @@
 
 #include "toolbarlayout.h"
 
+#include <algorithm>
 #include <cmath>
 #include <unordered_map>
+#include <vector>
 
 #include <QDeadlineTimer>
 #include <QQmlComponent>
+#include <QSet>
 #include <QTimer>
 
 #include "enums.h"
 #include "loggingcategory.h"
 #include "toolbarlayoutdelegate.h"
 
+// Delegates of removed actions kept around to be reused for new actions.
+static const std::size_t s_maximumSpareDelegates = 8;
+
 ToolBarLayoutAttached::ToolBarLayoutAttached(QObject *parent)
     : QObject(parent)
 {
@@ -29,7 +35,12 @@ QObject *ToolBarLayoutAttached::action() const
 
 void ToolBarLayoutAttached::setAction(QObject *action)
 {
+    if (action == m_action) {
+        return;
+    }
+
     m_action = action;
+    Q_EMIT actionChanged();
 }
 
 class ToolBarLayout::Private
@@ -43,6 +54,7 @@ public:
     void performLayout();
     QVector<ToolBarLayoutDelegate *> createDelegates();
     ToolBarLayoutDelegate *createDelegate(QObject *action);
+    void releaseDelegate(QObject *action);
     qreal layoutStart(qreal layoutWidth);
     void maybeHideDelegate(int index, qreal &currentWidth, qreal totalWidth);
 
@@ -72,6 +84,8 @@ public:
 
     QVector<QObject *> removedActions;
     QTimer *removalTimer = nullptr;
+    std::vector<std::unique_ptr<ToolBarLayoutDelegate>> spareDelegates;
+    QSet<QObject *> connectedActions;
 
     QElapsedTimer performanceTimer;
 
@@ -96,7 +110,7 @@ ToolBarLayout::ToolBarLayout(QQuickItem *parent)
     connect(d->removalTimer, &QTimer::timeout, this, [this]() {
         for (auto action : std::as_const(d->removedActions)) {
             if (!d->actions.contains(action)) {
-                d->delegates.erase(action);
+                d->releaseDelegate(action);
             }
         }
         d->removedActions.clear();
@@ -117,17 +131,31 @@ void ToolBarLayout::addAction(QObject *action)
     d->actions.append(action);
     d->actionsChanged = true;
 
-    connect(action, &QObject::destroyed, this, [this](QObject *action) {
-        auto itr = d->delegates.find(action);
-        if (itr != d->delegates.end()) {
-            d->delegates.erase(itr);
-        }
+    // Assigning a list clears and appends all actions again, only connect
+    // once per action.
+    if (!d->connectedActions.contains(action)) {
+        d->connectedActions.insert(action);
+        connect(action, &QObject::destroyed, this, [this](QObject *action) {
+            auto itr = d->delegates.find(action);
+            if (itr != d->delegates.end()) {
+                d->delegates.erase(itr);
+            }
 
-        d->actions.removeOne(action);
-        d->actionsChanged = true;
+            d->spareDelegates.erase(std::remove_if(d->spareDelegates.begin(),
+                                                   d->spareDelegates.end(),
+                                                   [action](const std::unique_ptr<ToolBarLayoutDelegate> &delegate) {
+                                                       return delegate->action() == action;
+                                                   }),
+                                    d->spareDelegates.end());
 
-        relayout();
-    });
+            d->connectedActions.remove(action);
+            d->actions.removeAll(action);
+            d->removedActions.removeAll(action);
+            d->actionsChanged = true;
+
+            relayout();
+        });
+    }
 
     relayout();
 }
@@ -181,6 +209,7 @@ void ToolBarLayout::setFullDelegate(QQmlComponent *newFullDelegate)
 
     d->fullDelegate = newFullDelegate;
     d->delegates.clear();
+    d->spareDelegates.clear();
     relayout();
     Q_EMIT fullDelegateChanged();
 }
@@ -198,6 +227,7 @@ void ToolBarLayout::setIconDelegate(QQmlComponent *newIconDelegate)
 
     d->iconDelegate = newIconDelegate;
     d->delegates.clear();
+    d->spareDelegates.clear();
     relayout();
     Q_EMIT iconDelegateChanged();
 }
@@ -540,9 +570,19 @@ ToolBarLayoutDelegate *ToolBarLayout::Private::createDelegate(QObject *action)
 
     if (!fullComponent) {
         fullComponent = fullDelegate;
+
+        // Delegates from the default components only depend on their action,
+        // so one that was used for a removed action can show this one.
+        if (!spareDelegates.empty()) {
+            auto result = spareDelegates.back().release();
+            spareDelegates.pop_back();
+            result->rebind(action);
+            return result;
+        }
     }
 
     auto result = new ToolBarLayoutDelegate(q);
+    result->setRecyclable(fullComponent == fullDelegate);
     result->setAction(action);
     result->createItems(fullComponent, iconDelegate, [this, action](QQuickItem *newItem) {
         newItem->setParentItem(q);
@@ -553,6 +593,22 @@ ToolBarLayoutDelegate *ToolBarLayout::Private::createDelegate(QObject *action)
     return result;
 }
 
+void ToolBarLayout::Private::releaseDelegate(QObject *action)
+{
+    auto itr = delegates.find(action);
+    if (itr == delegates.end()) {
+        return;
+    }
+
+    auto delegate = std::move(itr->second);
+    delegates.erase(itr);
+
+    if (delegate->isRecyclable() && delegate->isReady() && spareDelegates.size() < s_maximumSpareDelegates) {
+        delegate->hide();
+        spareDelegates.push_back(std::move(delegate));
+    }
+}
+
 qreal ToolBarLayout::Private::layoutStart(qreal layoutWidth)
 {
     qreal availableWidth = moreButtonInstance->isVisible() ? q->width() - (moreButtonInstance->width() + spacing) : q->width();
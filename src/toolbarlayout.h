@@ -18,13 +18,17 @@ class ToolBarLayoutAttached : public QObject
     Q_OBJECT
     /**
      * The action this delegate was created for.
+     *
+     * Delegates are reused for other actions once their action is removed, so
+     * this can change during the lifetime of a delegate.
      */
-    Q_PROPERTY(QObject *action READ action CONSTANT)
+    Q_PROPERTY(QObject *action READ action NOTIFY actionChanged)
 public:
     ToolBarLayoutAttached(QObject *parent = nullptr);
 
     QObject *action() const;
     void setAction(QObject *action);
+    Q_SIGNAL void actionChanged();
 
 private:
     QObject *m_action = nullptr;
@@ -184,6 +184,29 @@ void ToolBarLayoutDelegate::createItems(QQmlComponent *fullComponent, QQmlCompon
     m_iconIncubator->create();
 }
 
+bool ToolBarLayoutDelegate::isRecyclable() const
+{
+    return m_recyclable;
+}
+
+void ToolBarLayoutDelegate::setRecyclable(bool recyclable)
+{
+    m_recyclable = recyclable;
+}
+
+void ToolBarLayoutDelegate::rebind(QObject *action)
+{
+    setAction(action);
+
+    for (auto item : {m_full, m_icon}) {
+        if (!item) {
+            continue;
+        }
+        auto attached = static_cast<ToolBarLayoutAttached *>(qmlAttachedPropertiesObject<ToolBarLayout>(item, true));
+        attached->setAction(action);
+    }
+}
+
 bool ToolBarLayoutDelegate::isReady() const
 {
     return m_ready;
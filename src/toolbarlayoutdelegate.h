@@ -56,6 +56,17 @@ public:
     void setAction(QObject *action);
     void createItems(QQmlComponent *fullComponent, QQmlComponent *iconComponent, std::function<void(QQuickItem *)> callback);
 
+    /*
+     * Whether the items of this delegate were created from the default
+     * components of the layout, so they can be reused for other actions.
+     */
+    bool isRecyclable() const;
+    void setRecyclable(bool recyclable);
+    /*
+     * Show a different action with the existing items.
+     */
+    void rebind(QObject *action);
+
     bool isReady() const;
     bool isActionVisible() const;
     bool isHidden() const;
@@ -101,6 +112,7 @@ private:
 
     DisplayHint::DisplayHints m_displayHint = DisplayHint::NoPreference;
     bool m_ready = false;
+    bool m_recyclable = false;
     bool m_actionVisible = true;
     bool m_fullVisible = false;
     bool m_iconVisible = false;
@@ -0,0 +1,100 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+
+import org.kde.kirigami 2.19 as Kirigami
+
+/*
+ * Scrolls through 300 avatars, all of them instantiated at once, and prints
+ * the frame times every few hundred frames.
+ *
+ * Run it with qmlscene, once with each version of Avatar to compare. Every
+ * third avatar shows an image, the others show initials. GPU memory can be
+ * read from the driver while it runs, for example with
+ * `nvidia-smi --query-compute-apps=pid,used_memory --format=csv` or from
+ * /sys/kernel/debug/dri/0/ on Mesa drivers. QSG_RENDER_TIMING=1 additionally
+ * splits each frame into sync, render and swap times.
+ */
+Kirigami.ApplicationWindow {
+    id: window
+
+    width: 800
+    height: 600
+
+    readonly property int avatarCount: 300
+    readonly property int reportInterval: 300
+
+    property var frameTimes: []
+    property double lastFrame: 0
+
+    onFrameSwapped: {
+        const now = Date.now();
+        if (lastFrame > 0) {
+            frameTimes.push(now - lastFrame);
+        }
+        lastFrame = now;
+
+        if (frameTimes.length < reportInterval) {
+            return;
+        }
+
+        const sorted = frameTimes.slice().sort((a, b) => a - b);
+        const average = sorted.reduce((sum, time) => sum + time, 0) / sorted.length;
+        console.log("Frame time over", sorted.length, "frames:",
+                    "average", average.toFixed(2), "ms,",
+                    "median", sorted[Math.floor(sorted.length / 2)], "ms,",
+                    "99th percentile", sorted[Math.floor(sorted.length * 0.99)], "ms,",
+                    "max", sorted[sorted.length - 1], "ms");
+        frameTimes = [];
+    }
+
+    pageStack.initialPage: Kirigami.ScrollablePage {
+        id: page
+        title: "%1 avatars".arg(window.avatarCount)
+
+        actions.main: Kirigami.Action {
+            text: scrollAnimation.running ? "Stop scrolling" : "Scroll"
+            onTriggered: scrollAnimation.running = !scrollAnimation.running
+        }
+
+        Flow {
+            id: flow
+            spacing: Kirigami.Units.smallSpacing
+
+            Repeater {
+                model: window.avatarCount
+
+                Kirigami.Avatar {
+                    name: "Avatar " + String.fromCharCode(65 + index % 26) + " " + index
+                    source: index % 3 === 0 ? Qt.resolvedUrl("../logo.png") : ""
+                    border.width: index % 2
+                    border.color: Kirigami.Theme.highlightColor
+                }
+            }
+        }
+
+        SequentialAnimation {
+            id: scrollAnimation
+            running: true
+            loops: Animation.Infinite
+
+            NumberAnimation {
+                target: page.flickable
+                property: "contentY"
+                from: 0
+                to: Math.max(0, page.flickable.contentHeight - page.flickable.height)
+                duration: 4000
+            }
+            NumberAnimation {
+                target: page.flickable
+                property: "contentY"
+                to: 0
+                duration: 4000
+            }
+        }
+    }
+}
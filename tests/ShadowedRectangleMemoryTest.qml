@@ -0,0 +1,89 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick 2.15
+
+import org.kde.kirigami 2.19 as Kirigami
+
+/*
+ * Creates 500 ShadowedRectangles at a time, either without touching their
+ * border, shadow and corners groups or with all of them set.
+ *
+ * Run it with heaptrack, or watch VmRSS in /proc/<pid>/status, and create and
+ * clear each set a few times. The difference in heap usage between the two
+ * sets, divided by 500, is what each item spends on its groups.
+ */
+Kirigami.ApplicationWindow {
+    id: window
+
+    width: 600
+    height: 800
+
+    readonly property int rectangleCount: 500
+
+    pageStack.initialPage: Kirigami.ScrollablePage {
+        title: "%1 rectangles".arg(repeater.count)
+
+        actions {
+            left: Kirigami.Action {
+                text: "Without groups"
+                onTriggered: {
+                    repeater.model = 0;
+                    repeater.delegate = plainRectangle;
+                    repeater.model = window.rectangleCount;
+                }
+            }
+            main: Kirigami.Action {
+                text: "Clear"
+                onTriggered: repeater.model = 0
+            }
+            right: Kirigami.Action {
+                text: "With groups"
+                onTriggered: {
+                    repeater.model = 0;
+                    repeater.delegate = groupedRectangle;
+                    repeater.model = window.rectangleCount;
+                }
+            }
+        }
+
+        Flow {
+            spacing: Kirigami.Units.smallSpacing
+
+            Repeater {
+                id: repeater
+                model: 0
+            }
+        }
+
+        Component {
+            id: plainRectangle
+
+            Kirigami.ShadowedRectangle {
+                width: Kirigami.Units.gridUnit * 2
+                height: width
+                color: Kirigami.Theme.highlightColor
+                radius: Kirigami.Units.smallSpacing
+            }
+        }
+
+        Component {
+            id: groupedRectangle
+
+            Kirigami.ShadowedRectangle {
+                width: Kirigami.Units.gridUnit * 2
+                height: width
+                color: Kirigami.Theme.highlightColor
+                radius: Kirigami.Units.smallSpacing
+
+                border.width: 1
+                border.color: Kirigami.Theme.textColor
+                shadow.size: Kirigami.Units.smallSpacing
+                corners.topLeftRadius: 0
+            }
+        }
+    }
+}
@@ -0,0 +1,135 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Kirigami contributors
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QBuffer>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include <iostream>
+
+#include "paletteindex.h"
+
+// ImageColors samples images at up to this size, not always keeping their
+// aspect ratio. Palettes only depend on the proportions of the colors, which
+// are the same either way.
+static const QSize s_sampleSize(128, 128);
+
+static QStringList collectFiles(const QStringList &paths, bool recursive)
+{
+    QStringList nameFilters;
+    const auto formats = QImageReader::supportedImageFormats();
+    for (const QByteArray &format : formats) {
+        nameFilters << QStringLiteral("*.") + QString::fromLatin1(format);
+    }
+
+    QStringList files;
+    for (const QString &path : paths) {
+        const QFileInfo info(path);
+        if (info.isFile()) {
+            files << info.absoluteFilePath();
+            continue;
+        }
+
+        QDirIterator it(info.absoluteFilePath(), nameFilters, QDir::Files, recursive ? QDirIterator::Subdirectories : QDirIterator::NoIteratorFlags);
+        while (it.hasNext()) {
+            files << QFileInfo(it.next()).absoluteFilePath();
+        }
+    }
+
+    files.removeDuplicates();
+    return files;
+}
+
+static PaletteIndex::Entry processFile(const QString &fileName)
+{
+    PaletteIndex::Entry entry;
+    entry.path = fileName;
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return entry;
+    }
+    const QByteArray content = file.readAll();
+
+    QBuffer buffer;
+    buffer.setData(content);
+    QImageReader reader(&buffer);
+    // Let the decoder downscale when it can, JPEG for example decodes at a lower resolution directly
+    QSize size = reader.size();
+    if (size.width() > s_sampleSize.width() || size.height() > s_sampleSize.height()) {
+        size.scale(s_sampleSize, Qt::KeepAspectRatio);
+        reader.setScaledSize(size);
+    }
+    const QImage image = reader.read();
+    if (image.isNull()) {
+        return entry;
+    }
+
+    entry.contentHash = PaletteIndex::hashContent(content);
+    entry.imageData = PaletteGenerator::generatePalette(image);
+    return entry;
+}
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("kirigami-palette-indexer"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Precomputes the palettes of images for Kirigami's ImageColors."));
+    parser.addHelpOption();
+    parser.addPositionalArgument(QStringLiteral("paths"), QStringLiteral("Image files or directories to index."), QStringLiteral("paths..."));
+    QCommandLineOption outputOption({QStringLiteral("o"), QStringLiteral("output")},
+                                    QStringLiteral("The index file to write."),
+                                    QStringLiteral("file"),
+                                    QStringLiteral("palettes.kpal"));
+    QCommandLineOption jobsOption({QStringLiteral("j"), QStringLiteral("jobs")},
+                                  QStringLiteral("Number of images processed in parallel, defaults to the number of cores."),
+                                  QStringLiteral("count"));
+    QCommandLineOption noRecursiveOption(QStringLiteral("no-recursive"), QStringLiteral("Don't descend into subdirectories."));
+    parser.addOptions({outputOption, jobsOption, noRecursiveOption});
+    parser.process(app);
+
+    if (parser.positionalArguments().isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    if (parser.isSet(jobsOption)) {
+        const int jobs = parser.value(jobsOption).toInt();
+        if (jobs > 0) {
+            QThreadPool::globalInstance()->setMaxThreadCount(jobs);
+        }
+    }
+
+    const QStringList files = collectFiles(parser.positionalArguments(), !parser.isSet(noRecursiveOption));
+    std::cout << "Indexing " << files.size() << " images" << std::endl;
+
+    const QVector<PaletteIndex::Entry> results = QtConcurrent::blockingMapped<QVector<PaletteIndex::Entry>>(files, processFile);
+
+    QVector<PaletteIndex::Entry> entries;
+    entries.reserve(results.size());
+    for (const auto &entry : results) {
+        if (entry.imageData.m_clusters.isEmpty()) {
+            std::cerr << "Skipping " << qPrintable(entry.path) << ": could not read image" << std::endl;
+            continue;
+        }
+        entries << entry;
+    }
+
+    const QString output = parser.value(outputOption);
+    if (!PaletteIndex::write(output, entries)) {
+        std::cerr << "Could not write " << qPrintable(output) << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << entries.size() << " palettes to " << qPrintable(output) << std::endl;
+    return 0;
+}